@@ -57,6 +57,18 @@
 #    define ENTT_PACKED_PAGE 1024
 #endif
 
+#ifndef ENTT_HUGE_PAGE
+#    define ENTT_HUGE_PAGE 2097152
+#endif
+
+#ifndef ENTT_PREFETCH
+#    if defined(__GNUC__) || defined(__clang__)
+#        define ENTT_PREFETCH(addr) __builtin_prefetch(addr)
+#    else
+#        define ENTT_PREFETCH(addr) (void(addr))
+#    endif
+#endif
+
 #ifdef ENTT_DISABLE_ASSERT
 #    undef ENTT_ASSERT
 #    define ENTT_ASSERT(condition, msg) (void(0))
@@ -0,0 +1,443 @@
+#ifndef ENTT_CONTAINER_BITSET_HPP
+#define ENTT_CONTAINER_BITSET_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "fwd.hpp"
+
+namespace entt {
+
+/*! @cond ENTT_INTERNAL */
+namespace internal {
+
+template<typename Container>
+class bitset_iterator final {
+    using word_type = Container::value_type;
+
+    static constexpr std::size_t word_bits = sizeof(word_type) * 8u;
+
+    [[nodiscard]] std::size_t next_word(const std::size_t from) const noexcept {
+        // summary bits tell apart empty and non-empty words, whole words are skipped at once
+        for(auto idx = from / word_bits, last = summary->size(); idx < last; ++idx) {
+            const auto mask = (idx == from / word_bits) ? ((*summary)[idx] & (~word_type{} << (from % word_bits))) : (*summary)[idx];
+
+            if(mask != word_type{}) {
+                return idx * word_bits + static_cast<std::size_t>(std::countr_zero(mask));
+            }
+        }
+
+        return words->size();
+    }
+
+    void seek(const std::size_t from) noexcept {
+        if(const auto idx = from / word_bits; idx < words->size()) {
+            if(const auto mask = (*words)[idx] & (~word_type{} << (from % word_bits)); mask != word_type{}) {
+                offset = idx * word_bits + static_cast<std::size_t>(std::countr_zero(mask));
+                return;
+            }
+
+            if(const auto next = next_word(idx + 1u); next < words->size()) {
+                offset = next * word_bits + static_cast<std::size_t>(std::countr_zero((*words)[next]));
+                return;
+            }
+        }
+
+        offset = words->size() * word_bits;
+    }
+
+public:
+    using value_type = std::size_t;
+    using pointer = const value_type *;
+    using reference = value_type;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::forward_iterator_tag;
+
+    constexpr bitset_iterator() noexcept = default;
+
+    bitset_iterator(const Container &ref, const Container &aux, const std::size_t pos) noexcept
+        : words{&ref},
+          summary{&aux} {
+        seek(pos);
+    }
+
+    bitset_iterator &operator++() noexcept {
+        return seek(offset + 1u), *this;
+    }
+
+    bitset_iterator operator++(int) noexcept {
+        const bitset_iterator orig = *this;
+        return ++(*this), orig;
+    }
+
+    [[nodiscard]] constexpr reference operator*() const noexcept {
+        return offset;
+    }
+
+    [[nodiscard]] constexpr bool operator==(const bitset_iterator &other) const noexcept {
+        return offset == other.offset;
+    }
+
+private:
+    const Container *words{};
+    const Container *summary{};
+    std::size_t offset{};
+};
+
+} // namespace internal
+/*! @endcond */
+
+/**
+ * @brief Two-level dynamic bitset.
+ *
+ * Bits are stored in machine words and a summary level keeps track of the
+ * non-empty words. Therefore, iterating the set bits skips empty words in
+ * blocks, while intersections and differences work one word at a time and are
+ * easily vectorized by the compiler.<br/>
+ * The bitset grows as needed when bits are set. Bits past the end are
+ * implicitly not set.
+ *
+ * @tparam Allocator Type of allocator used to manage memory and elements.
+ */
+template<typename Allocator>
+class basic_bitset {
+    using alloc_traits = std::allocator_traits<Allocator>;
+    static_assert(std::is_unsigned_v<typename alloc_traits::value_type>, "Invalid word type");
+    using container_type = std::vector<typename alloc_traits::value_type, Allocator>;
+
+    static constexpr std::size_t word_bits = sizeof(typename alloc_traits::value_type) * 8u;
+
+    void refresh(const std::size_t idx) noexcept {
+        const auto bit = word_type{1u} << (idx % word_bits);
+        words[idx] ? (summary[idx / word_bits] |= bit) : (summary[idx / word_bits] &= ~bit);
+    }
+
+    void refresh_all() noexcept {
+        std::fill(summary.begin(), summary.end(), word_type{});
+
+        for(std::size_t idx{}, last = words.size(); idx < last; ++idx) {
+            summary[idx / word_bits] |= static_cast<word_type>(words[idx] != word_type{}) << (idx % word_bits);
+        }
+    }
+
+    void assure_at_least(const std::size_t pos) {
+        if(const auto sz = pos / word_bits + 1u; words.size() < sz) {
+            words.resize(sz, word_type{});
+            summary.resize((sz + word_bits - 1u) / word_bits, word_type{});
+        }
+    }
+
+public:
+    /*! @brief Allocator type. */
+    using allocator_type = Allocator;
+    /*! @brief Underlying word type. */
+    using word_type = alloc_traits::value_type;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Input iterator type to the positions of the set bits. */
+    using iterator = internal::bitset_iterator<container_type>;
+    /*! @brief Constant input iterator type to the positions of the set bits. */
+    using const_iterator = iterator;
+
+    /*! @brief Default constructor. */
+    basic_bitset()
+        : basic_bitset{allocator_type{}} {}
+
+    /**
+     * @brief Constructs an empty bitset with a given allocator.
+     * @param allocator The allocator to use.
+     */
+    explicit basic_bitset(const allocator_type &allocator)
+        : words{allocator},
+          summary{allocator} {}
+
+    /**
+     * @brief Copy constructor.
+     * @param other The instance to copy from.
+     */
+    basic_bitset(const basic_bitset &other) = default;
+
+    /**
+     * @brief Allocator-extended copy constructor.
+     * @param other The instance to copy from.
+     * @param allocator The allocator to use.
+     */
+    basic_bitset(const basic_bitset &other, const allocator_type &allocator)
+        : words{other.words, allocator},
+          summary{other.summary, allocator} {}
+
+    /**
+     * @brief Move constructor.
+     * @param other The instance to move from.
+     */
+    basic_bitset(basic_bitset &&other) noexcept = default;
+
+    /**
+     * @brief Allocator-extended move constructor.
+     * @param other The instance to move from.
+     * @param allocator The allocator to use.
+     */
+    basic_bitset(basic_bitset &&other, const allocator_type &allocator)
+        : words{std::move(other.words), allocator},
+          summary{std::move(other.summary), allocator} {}
+
+    /*! @brief Default destructor. */
+    ~basic_bitset() = default;
+
+    /**
+     * @brief Copy assignment operator.
+     * @param other The instance to copy from.
+     * @return This bitset.
+     */
+    basic_bitset &operator=(const basic_bitset &other) = default;
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The instance to move from.
+     * @return This bitset.
+     */
+    basic_bitset &operator=(basic_bitset &&other) noexcept = default;
+
+    /**
+     * @brief Exchanges the contents with those of a given bitset.
+     * @param other Bitset to exchange the content with.
+     */
+    void swap(basic_bitset &other) noexcept {
+        using std::swap;
+        swap(words, other.words);
+        swap(summary, other.summary);
+    }
+
+    /**
+     * @brief Returns the associated allocator.
+     * @return The associated allocator.
+     */
+    [[nodiscard]] constexpr allocator_type get_allocator() const noexcept {
+        return words.get_allocator();
+    }
+
+    /**
+     * @brief Increases the capacity of a bitset.
+     * @param cap Desired capacity, that is, the number of bits.
+     */
+    void reserve(const size_type cap) {
+        const auto sz = (cap + word_bits - 1u) / word_bits;
+        words.reserve(sz);
+        summary.reserve((sz + word_bits - 1u) / word_bits);
+    }
+
+    /**
+     * @brief Returns the number of bits that a bitset has currently allocated
+     * space for.
+     * @return Capacity of the bitset.
+     */
+    [[nodiscard]] size_type capacity() const noexcept {
+        return words.capacity() * word_bits;
+    }
+
+    /*! @brief Requests the removal of unused capacity. */
+    void shrink_to_fit() {
+        while(!words.empty() && words.back() == word_type{}) {
+            words.pop_back();
+        }
+
+        summary.resize((words.size() + word_bits - 1u) / word_bits);
+        words.shrink_to_fit();
+        summary.shrink_to_fit();
+    }
+
+    /**
+     * @brief Returns the number of bits in use, that is, one past the last bit
+     * that can be set without growing the bitset.
+     * @return Number of bits in use.
+     */
+    [[nodiscard]] size_type size() const noexcept {
+        return words.size() * word_bits;
+    }
+
+    /**
+     * @brief Checks whether no bits are set.
+     * @return True if no bits are set, false otherwise.
+     */
+    [[nodiscard]] bool none() const noexcept {
+        return std::all_of(summary.cbegin(), summary.cend(), [](const word_type elem) { return elem == word_type{}; });
+    }
+
+    /**
+     * @brief Returns the number of bits set.
+     * @return Number of bits set.
+     */
+    [[nodiscard]] size_type count() const noexcept {
+        size_type sz{};
+
+        for(const auto elem: words) {
+            sz += static_cast<size_type>(std::popcount(elem));
+        }
+
+        return sz;
+    }
+
+    /**
+     * @brief Returns an iterator to the position of the first bit set.
+     *
+     * If no bits are set, the returned iterator will be equal to `end()`.
+     *
+     * @return An iterator to the position of the first bit set.
+     */
+    [[nodiscard]] const_iterator cbegin() const noexcept {
+        return const_iterator{words, summary, 0u};
+    }
+
+    /*! @copydoc cbegin */
+    [[nodiscard]] const_iterator begin() const noexcept {
+        return cbegin();
+    }
+
+    /**
+     * @brief Returns an iterator to the end.
+     * @return An iterator past the position of the last bit set.
+     */
+    [[nodiscard]] const_iterator cend() const noexcept {
+        return const_iterator{words, summary, size()};
+    }
+
+    /*! @copydoc cend */
+    [[nodiscard]] const_iterator end() const noexcept {
+        return cend();
+    }
+
+    /**
+     * @brief Checks whether a bit is set.
+     * @param pos Position of the bit to test.
+     * @return True if the bit is set, false otherwise.
+     */
+    [[nodiscard]] bool test(const size_type pos) const noexcept {
+        const auto idx = pos / word_bits;
+        return (idx < words.size()) && ((words[idx] >> (pos % word_bits)) & word_type{1u});
+    }
+
+    /**
+     * @brief Sets a bit, the bitset grows as needed.
+     * @param pos Position of the bit to set.
+     */
+    void set(const size_type pos) {
+        assure_at_least(pos);
+        words[pos / word_bits] |= word_type{1u} << (pos % word_bits);
+        summary[pos / word_bits / word_bits] |= word_type{1u} << ((pos / word_bits) % word_bits);
+    }
+
+    /**
+     * @brief Resets a bit.
+     * @param pos Position of the bit to reset.
+     */
+    void reset(const size_type pos) noexcept {
+        if(const auto idx = pos / word_bits; idx < words.size()) {
+            words[idx] &= ~(word_type{1u} << (pos % word_bits));
+            refresh(idx);
+        }
+    }
+
+    /*! @brief Resets all bits. */
+    void clear() noexcept {
+        words.clear();
+        summary.clear();
+    }
+
+    /**
+     * @brief Keeps only the bits that are also set in another bitset.
+     * @param other A valid bitset.
+     * @return This bitset.
+     */
+    basic_bitset &operator&=(const basic_bitset &other) noexcept {
+        const auto sz = (std::min)(words.size(), other.words.size());
+
+        for(size_type idx{}; idx < sz; ++idx) {
+            words[idx] &= other.words[idx];
+        }
+
+        std::fill(words.begin() + static_cast<typename container_type::difference_type>(sz), words.end(), word_type{});
+        refresh_all();
+
+        return *this;
+    }
+
+    /**
+     * @brief Sets all bits that are set in another bitset.
+     * @param other A valid bitset.
+     * @return This bitset.
+     */
+    basic_bitset &operator|=(const basic_bitset &other) {
+        if(!other.words.empty()) {
+            assure_at_least(other.size() - 1u);
+        }
+
+        for(size_type idx{}, sz = other.words.size(); idx < sz; ++idx) {
+            words[idx] |= other.words[idx];
+        }
+
+        for(size_type idx{}, sz = other.summary.size(); idx < sz; ++idx) {
+            summary[idx] |= other.summary[idx];
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Resets all bits that are set in another bitset.
+     * @param other A valid bitset.
+     * @return This bitset.
+     */
+    basic_bitset &operator-=(const basic_bitset &other) noexcept {
+        for(size_type idx{}, sz = (std::min)(words.size(), other.words.size()); idx < sz; ++idx) {
+            words[idx] &= ~other.words[idx];
+        }
+
+        refresh_all();
+
+        return *this;
+    }
+
+    /**
+     * @brief Direct access to the words of a bitset.
+     * @return A pointer to the array of words.
+     */
+    [[nodiscard]] const word_type *data() const noexcept {
+        return words.data();
+    }
+
+private:
+    container_type words;
+    container_type summary;
+};
+
+/**
+ * @brief Checks whether two bitsets have the same bits set.
+ * @tparam Allocator Type of allocator used to manage memory and elements.
+ * @param lhs A valid bitset.
+ * @param rhs A valid bitset.
+ * @return True if the two bitsets have the same bits set, false otherwise.
+ */
+template<typename Allocator>
+[[nodiscard]] bool operator==(const basic_bitset<Allocator> &lhs, const basic_bitset<Allocator> &rhs) noexcept {
+    const auto *first = lhs.data();
+    const auto *second = rhs.data();
+    const auto bits = sizeof(typename basic_bitset<Allocator>::word_type) * 8u;
+    const auto sz = (std::min)(lhs.size(), rhs.size()) / bits;
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return std::equal(first, first + sz, second)
+           && std::all_of(first + sz, first + lhs.size() / bits, [](const auto elem) { return elem == 0u; })
+           && std::all_of(second + sz, second + rhs.size() / bits, [](const auto elem) { return elem == 0u; });
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+} // namespace entt
+
+#endif
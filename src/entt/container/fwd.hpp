@@ -1,6 +1,7 @@
 #ifndef ENTT_CONTAINER_FWD_HPP
 #define ENTT_CONTAINER_FWD_HPP
 
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <utility>
@@ -26,6 +27,12 @@ class dense_set;
 template<typename...>
 class basic_table;
 
+template<typename = std::allocator<std::uint64_t>>
+class basic_bitset;
+
+/*! @brief Alias declaration for the most common use case. */
+using bitset = basic_bitset<>;
+
 /**
  * @brief Alias declaration for the most common use case.
  * @tparam Type Element types.
@@ -3,15 +3,32 @@
 
 #include <algorithm>
 #include <concepts>
+#include <cstddef>
 #include <functional>
 #include <iterator>
 #include <utility>
 #include <vector>
+#include "../config/config.h"
 #include "../stl/functional.hpp"
 #include "../stl/iterator.hpp"
 
 namespace entt {
 
+/*! @cond ENTT_INTERNAL */
+namespace internal {
+
+template<std::size_t N, typename Type>
+[[nodiscard]] constexpr bool radix_key_fits([[maybe_unused]] const Type key) noexcept {
+    if constexpr(N < (sizeof(Type) * 8u)) {
+        return (key >> N) == Type{};
+    } else {
+        return true;
+    }
+}
+
+} // namespace internal
+/*! @endcond */
+
 /**
  * @brief Function object to wrap `std::sort` in a class type.
  *
@@ -70,8 +87,49 @@ struct insertion_sort {
     }
 };
 
+/**
+ * @brief Function object for performing parallel merge sort.
+ *
+ * The range is split recursively and both halves are sorted concurrently by
+ * means of an executor, then they are merged in place. Short ranges are sorted
+ * sequentially with `std::sort`.<br/>
+ * Any type that offers a `parallel_for` member function can be used as an
+ * executor.
+ */
+struct parallel_sort {
+    /*! @brief Ranges shorter than this are sorted sequentially. */
+    static constexpr std::size_t threshold = 4096u;
+
+    /**
+     * @brief Sorts the elements in a range.
+     *
+     * Sorts the elements in a range using the given binary comparison function.
+     *
+     * @tparam It Type of random access iterator.
+     * @tparam Compare Type of comparison function object.
+     * @tparam Executor Type of executor.
+     * @param first An iterator to the first element of the range to sort.
+     * @param last An iterator past the last element of the range to sort.
+     * @param compare A valid comparison function object.
+     * @param jobs The executor to use to sort the elements.
+     */
+    template<stl::random_access_iterator It, typename Compare, typename Executor>
+    void operator()(It first, It last, Compare compare, Executor &jobs) const {
+        if(const auto length = static_cast<std::size_t>(std::distance(first, last)); length < threshold) {
+            std::sort(std::move(first), std::move(last), std::move(compare));
+        } else {
+            const auto middle = first + static_cast<std::iterator_traits<It>::difference_type>(length / 2u);
+            jobs.parallel_for(2u, [&](const std::size_t pos) { (pos == 0u) ? (*this)(first, middle, compare, jobs) : (*this)(middle, last, compare, jobs); });
+            std::inplace_merge(first, middle, last, std::move(compare));
+        }
+    }
+};
+
 /**
  * @brief Function object for performing LSD radix sort.
+ *
+ * Only the lowest `N` bits of the keys are sorted, higher bits are ignored.
+ *
  * @tparam Bit Number of bits processed per pass.
  * @tparam N Maximum number of bits to sort.
  */
@@ -95,12 +153,36 @@ struct radix_sort {
      */
     template<stl::random_access_iterator It, typename Getter = stl::identity>
     void operator()(It first, It last, Getter getter = Getter{}) const {
+        std::vector<typename std::iterator_traits<It>::value_type> aux{};
+        (*this)(std::move(first), std::move(last), std::move(getter), aux);
+    }
+
+    /**
+     * @brief Sorts the elements in a range using an auxiliary buffer.
+     *
+     * The buffer is resized if it's smaller than the range to sort, otherwise
+     * it's used as-is. Reusing the same buffer across multiple calls avoids
+     * allocating memory every time.
+     *
+     * @tparam It Type of random access iterator.
+     * @tparam Getter Type of _getter_ function object.
+     * @tparam Allocator Type of allocator of the auxiliary buffer.
+     * @param first An iterator to the first element of the range to sort.
+     * @param last An iterator past the last element of the range to sort.
+     * @param getter A valid _getter_ function object.
+     * @param aux The auxiliary buffer to use.
+     */
+    template<stl::random_access_iterator It, typename Getter, typename Allocator>
+    void operator()(It first, It last, Getter getter, std::vector<typename std::iterator_traits<It>::value_type, Allocator> &aux) const {
         if(first < last) {
             constexpr auto passes = N / Bit;
 
-            using value_type = std::iterator_traits<It>::value_type;
             using difference_type = std::iterator_traits<It>::difference_type;
-            std::vector<value_type> aux(static_cast<std::size_t>(std::distance(first, last)));
+            const auto length = std::distance(first, last);
+
+            if(aux.size() < static_cast<std::size_t>(length)) {
+                aux.resize(static_cast<std::size_t>(length));
+            }
 
             auto part = [getter = std::move(getter)](auto from, auto to, auto out, auto start) {
                 constexpr auto mask = (1 << Bit) - 1;
@@ -128,12 +210,128 @@ struct radix_sort {
 
             for(std::size_t pass = 0; pass < (passes & ~1u); pass += 2) {
                 part(first, last, aux.begin(), pass * Bit);
-                part(aux.begin(), aux.end(), first, (pass + 1) * Bit);
+                part(aux.begin(), aux.begin() + length, first, (pass + 1) * Bit);
             }
 
             if constexpr(passes & 1) {
                 part(first, last, aux.begin(), (passes - 1) * Bit);
-                std::move(aux.begin(), aux.end(), first);
+                std::move(aux.begin(), aux.begin() + length, first);
+            }
+        }
+    }
+};
+
+/**
+ * @brief Function object for performing parallel LSD radix sort.
+ *
+ * The range is split in a fixed number of blocks. Each pass builds a histogram
+ * per block, merges them into per-block offsets and finally scatters all
+ * blocks concurrently. The relative order of the blocks is preserved, so that
+ * the sort is stable as it happens with `radix_sort`.<br/>
+ * Histograms live on the stack and take `Blocks * (1 << Bit)` counters. Unlike
+ * `radix_sort`, keys must fit the given number of bits. This is checked in
+ * debug builds.
+ *
+ * @tparam Bit Number of bits processed per pass.
+ * @tparam N Maximum number of bits to sort.
+ * @tparam Blocks Number of blocks processed in parallel.
+ */
+template<std::size_t Bit, std::size_t N, std::size_t Blocks = 16u>
+requires ((N % Bit) == 0) && (Blocks != 0u) // The maximum number of bits to sort must be a multiple of the number of bits processed per pass
+struct parallel_radix_sort {
+    /**
+     * @brief Sorts the elements in a range.
+     *
+     * @sa radix_sort
+     *
+     * @tparam It Type of random access iterator.
+     * @tparam Getter Type of _getter_ function object.
+     * @tparam Executor Type of executor.
+     * @param first An iterator to the first element of the range to sort.
+     * @param last An iterator past the last element of the range to sort.
+     * @param getter A valid _getter_ function object.
+     * @param jobs The executor to use to sort the elements.
+     */
+    template<stl::random_access_iterator It, typename Getter, typename Executor>
+    void operator()(It first, It last, Getter getter, Executor &jobs) const {
+        std::vector<typename std::iterator_traits<It>::value_type> aux{};
+        (*this)(std::move(first), std::move(last), std::move(getter), jobs, aux);
+    }
+
+    /**
+     * @brief Sorts the elements in a range using an auxiliary buffer.
+     *
+     * The buffer is resized if it's smaller than the range to sort, otherwise
+     * it's used as-is. Reusing the same buffer across multiple calls avoids
+     * allocating memory every time.
+     *
+     * @tparam It Type of random access iterator.
+     * @tparam Getter Type of _getter_ function object.
+     * @tparam Executor Type of executor.
+     * @tparam Allocator Type of allocator of the auxiliary buffer.
+     * @param first An iterator to the first element of the range to sort.
+     * @param last An iterator past the last element of the range to sort.
+     * @param getter A valid _getter_ function object.
+     * @param jobs The executor to use to sort the elements.
+     * @param aux The auxiliary buffer to use.
+     */
+    template<stl::random_access_iterator It, typename Getter, typename Executor, typename Allocator>
+    void operator()(It first, It last, Getter getter, Executor &jobs, std::vector<typename std::iterator_traits<It>::value_type, Allocator> &aux) const {
+        if(first < last) {
+            constexpr auto passes = N / Bit;
+
+            using difference_type = std::iterator_traits<It>::difference_type;
+            const auto length = static_cast<std::size_t>(std::distance(first, last));
+            const auto step = (length + Blocks - 1u) / Blocks;
+
+            if(aux.size() < length) {
+                aux.resize(length);
+            }
+
+            auto part = [&getter, &jobs, length, step](auto from, auto out, auto start) {
+                constexpr std::size_t buckets = std::size_t{1u} << Bit;
+                constexpr auto mask = buckets - 1u;
+
+                // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, modernize-avoid-c-arrays)
+                std::size_t count[Blocks][buckets]{};
+
+                jobs.parallel_for(Blocks, [&](const std::size_t block) {
+                    for(auto pos = block * step, end = (std::min)(pos + step, length); pos < end; ++pos) {
+                        const auto key = getter(from[static_cast<difference_type>(pos)]);
+                        ENTT_ASSERT(internal::radix_key_fits<N>(key), "Key exceeds the number of bits to sort");
+                        ++count[block][(key >> start) & mask];
+                    }
+                });
+
+                // blocks are visited in order for each bucket to keep the sort stable
+                for(std::size_t bucket{}, offset{}; bucket < buckets; ++bucket) {
+                    for(std::size_t block{}; block < Blocks; ++block) {
+                        offset += std::exchange(count[block][bucket], offset);
+                    }
+                }
+
+                jobs.parallel_for(Blocks, [&](const std::size_t block) {
+                    for(auto pos = block * step, end = (std::min)(pos + step, length); pos < end; ++pos) {
+                        auto &&elem = from[static_cast<difference_type>(pos)];
+                        const auto idx = count[block][(getter(elem) >> start) & mask]++;
+                        out[static_cast<difference_type>(idx)] = std::move(elem);
+                    }
+                });
+            };
+
+            for(std::size_t pass = 0; pass < (passes & ~1u); pass += 2) {
+                part(first, aux.begin(), pass * Bit);
+                part(aux.begin(), first, (pass + 1) * Bit);
+            }
+
+            if constexpr(passes & 1) {
+                part(first, aux.begin(), (passes - 1) * Bit);
+
+                jobs.parallel_for(Blocks, [&first, &aux, length, step](const std::size_t block) {
+                    const auto pos = (std::min)(block * step, length);
+                    const auto end = (std::min)(pos + step, length);
+                    std::move(aux.begin() + static_cast<difference_type>(pos), aux.begin() + static_cast<difference_type>(end), first + static_cast<difference_type>(pos));
+                });
             }
         }
     }
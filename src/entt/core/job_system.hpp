@@ -0,0 +1,474 @@
+#ifndef ENTT_CORE_JOB_SYSTEM_HPP
+#define ENTT_CORE_JOB_SYSTEM_HPP
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include "../config/config.h"
+#include "type_traits.hpp"
+
+namespace entt {
+
+class job_system;
+
+/**
+ * @brief Unit of work to run on a job system.
+ *
+ * A job doesn't own the function it invokes. The function and the job itself
+ * must outlive the execution, that is, they must be kept alive until the job is
+ * done.<br/>
+ * Jobs can be organized in trees. A job is done only when its function returned
+ * and all its children are done in turn. This allows using a parent job as a
+ * continuation counter to wait on for an entire set of jobs.
+ */
+class job final {
+    friend class job_system;
+
+    template<typename Func>
+    static void invoke(const void *payload) {
+        (*static_cast<Func *>(const_cast<constness_as_t<void, Func> *>(payload)))();
+    }
+
+public:
+    /*! @brief Raw job function type. */
+    using function_type = void(const void *);
+
+    /**
+     * @brief Constructs a job from a raw function and an optional payload.
+     * @param func A valid function to invoke.
+     * @param payload User defined arbitrary data.
+     * @param owner An optional parent job.
+     */
+    job(function_type *func, const void *payload = nullptr, job *owner = nullptr) noexcept
+        : callback{func},
+          data{payload},
+          parent{owner} {
+        ENTT_ASSERT(callback != nullptr, "Invalid function");
+        parent ? void(parent->pending.fetch_add(1u, std::memory_order_relaxed)) : void();
+    }
+
+    /**
+     * @brief Constructs a job from a function object.
+     * @tparam Func Type of function object to invoke.
+     * @param func A valid function object that outlives the job.
+     * @param owner An optional parent job.
+     */
+    template<typename Func>
+    requires std::is_invocable_v<Func &>
+    explicit job(Func &func, job *owner = nullptr) noexcept
+        : job{&invoke<Func>, &func, owner} {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    job(const job &) = delete;
+
+    /*! @brief Default move constructor, deleted on purpose. */
+    job(job &&) = delete;
+
+    /*! @brief Default destructor. */
+    ~job() = default;
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This job.
+     */
+    job &operator=(const job &) = delete;
+
+    /**
+     * @brief Default move assignment operator, deleted on purpose.
+     * @return This job.
+     */
+    job &operator=(job &&) = delete;
+
+    /**
+     * @brief Checks if a job and all its children are done.
+     * @return True if the job is done, false otherwise.
+     */
+    [[nodiscard]] bool done() const noexcept {
+        return pending.load(std::memory_order_acquire) == 0u;
+    }
+
+    /**
+     * @brief Checks if a job or any of its children threw an exception.
+     * @return True if the job failed, false otherwise.
+     */
+    [[nodiscard]] bool failed() const noexcept {
+        return error_flag.load(std::memory_order_acquire);
+    }
+
+private:
+    function_type *callback;
+    const void *data;
+    job *parent;
+    std::atomic<std::size_t> pending{1u};
+    std::atomic<bool> error_flag{};
+    std::exception_ptr error{};
+};
+
+/*! @cond ENTT_INTERNAL */
+namespace internal {
+
+class job_queue final {
+    static constexpr std::size_t length = 4096u;
+    static constexpr std::size_t mask = length - 1u;
+    static constexpr std::size_t line = 64u;
+
+    [[nodiscard]] static std::size_t slot(const std::ptrdiff_t pos) noexcept {
+        return static_cast<std::size_t>(pos) & mask;
+    }
+
+public:
+    bool push(job *elem) noexcept {
+        const auto last = bottom.load(std::memory_order_relaxed);
+
+        if(static_cast<std::size_t>(last - top.load(std::memory_order_acquire)) >= length) {
+            return false;
+        }
+
+        buffer[slot(last)].store(elem, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom.store(last + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    [[nodiscard]] job *pop() noexcept {
+        const auto last = bottom.load(std::memory_order_relaxed) - 1;
+        bottom.store(last, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        auto first = top.load(std::memory_order_relaxed);
+        job *elem = nullptr;
+
+        if(first <= last) {
+            elem = buffer[slot(last)].load(std::memory_order_relaxed);
+
+            if(first == last) {
+                if(!top.compare_exchange_strong(first, first + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                    elem = nullptr;
+                }
+
+                bottom.store(last + 1, std::memory_order_relaxed);
+            }
+        } else {
+            bottom.store(last + 1, std::memory_order_relaxed);
+        }
+
+        return elem;
+    }
+
+    [[nodiscard]] job *steal() noexcept {
+        auto first = top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if(first < bottom.load(std::memory_order_acquire)) {
+            job *elem = buffer[slot(first)].load(std::memory_order_relaxed);
+            return top.compare_exchange_strong(first, first + 1, std::memory_order_seq_cst, std::memory_order_relaxed) ? elem : nullptr;
+        }
+
+        return nullptr;
+    }
+
+private:
+    alignas(line) std::atomic<std::ptrdiff_t> top{};
+    alignas(line) std::atomic<std::ptrdiff_t> bottom{};
+    alignas(line) std::array<std::atomic<job *>, length> buffer{};
+};
+
+} // namespace internal
+/*! @endcond */
+
+/**
+ * @brief Work-stealing job system.
+ *
+ * Each worker owns a lock-free deque. Jobs submitted by a worker are pushed to
+ * its own deque and consumed in LIFO order, while idle workers steal from the
+ * opposite end of the others' deques. Jobs submitted from any other thread go
+ * through a shared queue instead.<br/>
+ * Waiting for a job never blocks the calling thread as long as there is work
+ * to do. Rather, the thread helps by running other jobs in the meantime.
+ */
+class job_system final {
+    using queue_type = internal::job_queue;
+
+    static constexpr std::size_t spin_count = 64u;
+
+    struct worker_data {
+        queue_type queue{};
+        std::thread thread{};
+    };
+
+    [[nodiscard]] static auto &local() noexcept {
+        static thread_local std::pair<const job_system *, std::size_t> data{};
+        return data;
+    }
+
+    [[nodiscard]] std::size_t self() const noexcept {
+        const auto &curr = local();
+        return (curr.first == this) ? curr.second : count;
+    }
+
+    [[nodiscard]] job *find(const std::size_t index) noexcept {
+        job *elem = nullptr;
+
+        if(index != count) {
+            elem = workers[index].queue.pop();
+        }
+
+        if(elem == nullptr && injected.load(std::memory_order_acquire) != 0u) {
+            const std::lock_guard guard{mutex};
+
+            if(!shared.empty()) {
+                elem = shared.front();
+                shared.pop_front();
+                injected.fetch_sub(1u, std::memory_order_release);
+            }
+        }
+
+        for(std::size_t next{1u}; elem == nullptr && next <= count; ++next) {
+            if(const auto victim = (index + next) % (count + 1u); victim != count) {
+                elem = workers[victim].queue.steal();
+            }
+        }
+
+        if(elem != nullptr) {
+            queued.fetch_sub(1u);
+        }
+
+        return elem;
+    }
+
+    void execute(job &elem) {
+        ENTT_TRY {
+            elem.callback(elem.data);
+        }
+        ENTT_CATCH {
+            const auto error = std::current_exception();
+
+            for(auto *curr = &elem; curr; curr = curr->parent) {
+                if(!curr->error_flag.exchange(true, std::memory_order_acq_rel)) {
+                    curr->error = error;
+                }
+            }
+        }
+
+        for(auto *curr = &elem; curr;) {
+            // a job can be destroyed as soon as its counter drops to zero
+            auto *next = curr->parent;
+            curr = (curr->pending.fetch_sub(1u, std::memory_order_acq_rel) == 1u) ? next : nullptr;
+        }
+    }
+
+    void worker(const std::size_t index) {
+        local() = {this, index};
+
+        for(std::size_t spin{}; !stop.load(std::memory_order_acquire);) {
+            if(auto *elem = find(index); elem) {
+                execute(*elem);
+                spin = 0u;
+            } else if(++spin < spin_count) {
+                std::this_thread::yield();
+            } else {
+                std::unique_lock guard{mutex};
+                ++sleeping;
+                cond.wait(guard, [this] { return stop.load(std::memory_order_relaxed) || queued.load() != 0u; });
+                --sleeping;
+                spin = 0u;
+            }
+        }
+    }
+
+    template<typename Func>
+    void split(const std::size_t first, const std::size_t last, Func &func) {
+        if(const auto length = last - first; length == 1u) {
+            func(first);
+        } else {
+            const auto middle = first + length / 2u;
+            join([&]() { split(first, middle, func); }, [&]() { split(middle, last, func); });
+        }
+    }
+
+public:
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Constructs a job system with the given level of concurrency.
+     *
+     * Threads that wait for jobs take part in their execution. Therefore, only
+     * `concurrency - 1` worker threads are spawned by the job system.
+     *
+     * @param concurrency The maximum number of jobs to run concurrently.
+     */
+    explicit job_system(const size_type concurrency = std::thread::hardware_concurrency())
+        : workers{},
+          count{concurrency > 1u ? (concurrency - 1u) : 0u} {
+        workers = std::make_unique<worker_data[]>(count);
+
+        for(size_type pos{}; pos < count; ++pos) {
+            workers[pos].thread = std::thread{&job_system::worker, this, pos};
+        }
+    }
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    job_system(const job_system &) = delete;
+
+    /*! @brief Default move constructor, deleted on purpose. */
+    job_system(job_system &&) = delete;
+
+    /**
+     * @brief Joins all the worker threads.
+     *
+     * @warning
+     * Jobs that are still pending are discarded without being invoked.
+     */
+    ~job_system() {
+        {
+            const std::lock_guard guard{mutex};
+            stop.store(true, std::memory_order_release);
+        }
+
+        cond.notify_all();
+
+        for(size_type pos{}; pos < count; ++pos) {
+            workers[pos].thread.join();
+        }
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This job system.
+     */
+    job_system &operator=(const job_system &) = delete;
+
+    /**
+     * @brief Default move assignment operator, deleted on purpose.
+     * @return This job system.
+     */
+    job_system &operator=(job_system &&) = delete;
+
+    /**
+     * @brief Returns the maximum number of jobs that run concurrently.
+     * @return The level of concurrency of the job system.
+     */
+    [[nodiscard]] size_type concurrency() const noexcept {
+        return count + 1u;
+    }
+
+    /**
+     * @brief Submits a job for execution.
+     *
+     * If the local deque of the calling worker is full, the job is executed
+     * immediately on the calling thread.
+     *
+     * @param elem A job that isn't yet submitted.
+     */
+    void submit(job &elem) {
+        queued.fetch_add(1u);
+
+        if(const auto index = self(); index != count) {
+            if(!workers[index].queue.push(&elem)) {
+                queued.fetch_sub(1u);
+                execute(elem);
+                return;
+            }
+        } else {
+            const std::lock_guard guard{mutex};
+            shared.push_back(&elem);
+            injected.fetch_add(1u, std::memory_order_release);
+        }
+
+        if(sleeping.load() != 0u) {
+            const std::lock_guard guard{mutex};
+            cond.notify_one();
+        }
+    }
+
+    /**
+     * @brief Waits for a job and all its children to complete.
+     *
+     * The calling thread runs other jobs in the meantime, if any.<br/>
+     * If the job or any of its children threw an exception, the first one is
+     * rethrown once the job is done.
+     *
+     * @param elem A submitted job.
+     */
+    void wait(const job &elem) {
+        for(const auto index = self(); !elem.done();) {
+            if(auto *other = find(index); other) {
+                execute(*other);
+            } else {
+                std::this_thread::yield();
+            }
+        }
+
+        if(elem.error) {
+            std::rethrow_exception(elem.error);
+        }
+    }
+
+    /**
+     * @brief Invokes two functions, possibly in parallel.
+     * @tparam Lhs Type of the first function object to invoke.
+     * @tparam Rhs Type of the second function object to invoke.
+     * @param lhs A function object to invoke on the calling thread.
+     * @param rhs A function object that can be stolen by other workers.
+     */
+    template<typename Lhs, typename Rhs>
+    void join(Lhs &&lhs, Rhs &&rhs) {
+        job other{rhs};
+        submit(other);
+
+        ENTT_TRY {
+            std::forward<Lhs>(lhs)();
+        }
+        ENTT_CATCH {
+            ENTT_TRY {
+                wait(other);
+            }
+            ENTT_CATCH {}
+
+            ENTT_THROW;
+        }
+
+        wait(other);
+    }
+
+    /**
+     * @brief Invokes a function once for each index in a range, in parallel.
+     *
+     * The function is invoked as `func(pos)`, with `pos` in `[0, length)`. The
+     * range is split recursively so that idle workers steal large portions of
+     * the remaining work first.
+     *
+     * @tparam Func Type of function object to invoke.
+     * @param length The number of indexes in the range.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void parallel_for(const size_type length, Func func) {
+        if(length != 0u) {
+            split(0u, length, func);
+        }
+    }
+
+private:
+    std::unique_ptr<worker_data[]> workers;
+    size_type count;
+    std::deque<job *> shared{};
+    std::mutex mutex{};
+    std::condition_variable cond{};
+    std::atomic<size_type> queued{};
+    std::atomic<size_type> injected{};
+    std::atomic<size_type> sleeping{};
+    std::atomic<bool> stop{};
+};
+
+} // namespace entt
+
+#endif
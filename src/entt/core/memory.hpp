@@ -1,8 +1,11 @@
 #ifndef ENTT_CORE_MEMORY_HPP
 #define ENTT_CORE_MEMORY_HPP
 
+#include <array>
+#include <bit>
 #include <cstddef>
 #include <memory>
+#include <new>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -221,6 +224,235 @@ constexpr Type *uninitialized_construct_using_allocator(Type *value, const auto
     return std::apply([value](auto &&...curr) { return ::new(value) Type(std::forward<decltype(curr)>(curr)...); }, internal::uses_allocator_construction<Type>::args(allocator, std::forward<Args>(args)...));
 }
 
+/**
+ * @brief Pool of memory blocks, for example the pages of a registry.
+ *
+ * Blocks whose size is a power of two between `min_block_size` and
+ * `max_block_size` and whose alignment doesn't exceed `block_alignment` are
+ * pooled, all other requests are forwarded to the global allocator.<br/>
+ * Deallocated blocks are kept in free lists, one for each size class, and
+ * reused by the following allocations of the same size, up to a given number
+ * of bytes. This way, steady-state workloads that repeatedly release and
+ * acquire pages don't hit the system allocator at all.
+ *
+ * @warning
+ * Pools aren't thread safe and must outlive all the blocks they allocate.
+ */
+class page_pool {
+    struct node_type {
+        node_type *next;
+    };
+
+public:
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /*! @brief Size of the smallest pooled blocks. */
+    static constexpr size_type min_block_size = 1024u;
+    /*! @brief Size of the largest pooled blocks. */
+    static constexpr size_type max_block_size = 2097152u;
+    /*! @brief Alignment of the pooled blocks. */
+    static constexpr size_type block_alignment = 64u;
+    /*! @brief Default number of bytes a pool caches at most. */
+    static constexpr size_type default_limit = 16u * max_block_size;
+
+private:
+    static constexpr auto classes = static_cast<size_type>(std::countr_zero(max_block_size) - std::countr_zero(min_block_size)) + 1u;
+
+    [[nodiscard]] static constexpr bool pooled(const size_type size, const size_type alignment) noexcept {
+        return std::has_single_bit(size) && !(size < min_block_size) && !(max_block_size < size) && !(block_alignment < alignment);
+    }
+
+    [[nodiscard]] static constexpr size_type class_of(const size_type size) noexcept {
+        return static_cast<size_type>(std::countr_zero(size) - std::countr_zero(min_block_size));
+    }
+
+public:
+    /*! @brief Default constructor. */
+    page_pool() noexcept
+        : page_pool{default_limit} {}
+
+    /**
+     * @brief Constructs a pool that caches up to a given number of bytes.
+     * @param bytes Maximum number of bytes to keep in the pool.
+     */
+    explicit page_pool(const size_type bytes) noexcept
+        : limit{bytes} {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    page_pool(const page_pool &) = delete;
+
+    /*! @brief Default move constructor, deleted on purpose. */
+    page_pool(page_pool &&) = delete;
+
+    /*! @brief Default destructor. */
+    ~page_pool() {
+        release();
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This pool.
+     */
+    page_pool &operator=(const page_pool &) = delete;
+
+    /**
+     * @brief Default move assignment operator, deleted on purpose.
+     * @return This pool.
+     */
+    page_pool &operator=(page_pool &&) = delete;
+
+    /**
+     * @brief Allocates a block of memory, possibly reusing a cached one.
+     * @param size Size of the block in bytes.
+     * @param alignment Alignment of the block.
+     * @return A pointer to the block.
+     */
+    [[nodiscard]] void *allocate(const size_type size, const size_type alignment = alignof(std::max_align_t)) {
+        if(!pooled(size, alignment)) {
+            return ::operator new(size, std::align_val_t{alignment});
+        }
+
+        if(auto &head = buckets[class_of(size)]; head != nullptr) {
+            cached_bytes -= size;
+            return std::exchange(head, head->next);
+        }
+
+        return ::operator new(size, std::align_val_t{block_alignment});
+    }
+
+    /**
+     * @brief Returns a block of memory to the pool.
+     * @param ptr A block previously returned by the pool.
+     * @param size Size of the block in bytes.
+     * @param alignment Alignment of the block.
+     */
+    void deallocate(void *ptr, const size_type size, const size_type alignment = alignof(std::max_align_t)) noexcept {
+        if(!pooled(size, alignment)) {
+            ::operator delete(ptr, size, std::align_val_t{alignment});
+        } else if(limit - cached_bytes < size) {
+            ::operator delete(ptr, size, std::align_val_t{block_alignment});
+        } else {
+            auto &head = buckets[class_of(size)];
+            head = ::new(ptr) node_type{head};
+            cached_bytes += size;
+        }
+    }
+
+    /**
+     * @brief Returns cached blocks to the system until the pool doesn't keep
+     * more than the given number of bytes.
+     * @param bytes Maximum number of bytes to keep in the pool.
+     */
+    void trim(const size_type bytes) noexcept {
+        // larger blocks first, they free more memory at once
+        for(auto pos = classes; pos != 0u && cached_bytes > bytes; --pos) {
+            for(const auto size = min_block_size << (pos - 1u); cached_bytes > bytes && buckets[pos - 1u];) {
+                ::operator delete(std::exchange(buckets[pos - 1u], buckets[pos - 1u]->next), size, std::align_val_t{block_alignment});
+                cached_bytes -= size;
+            }
+        }
+    }
+
+    /*! @brief Returns all cached blocks to the system. */
+    void release() noexcept {
+        trim(0u);
+    }
+
+    /**
+     * @brief Returns the number of bytes cached by the pool.
+     * @return The number of bytes cached by the pool.
+     */
+    [[nodiscard]] size_type cached() const noexcept {
+        return cached_bytes;
+    }
+
+private:
+    std::array<node_type *, classes> buckets{};
+    size_type cached_bytes{};
+    size_type limit;
+};
+
+/**
+ * @brief Allocator that draws memory from a page pool.
+ *
+ * All the allocators obtained from one another share the same pool. Therefore,
+ * a registry that uses this allocator shares the pool among all its pools.
+ *
+ * @tparam Type Type of objects to allocate.
+ */
+template<typename Type>
+class page_allocator {
+    template<typename>
+    friend class page_allocator;
+
+public:
+    /*! @brief Type of objects to allocate. */
+    using value_type = Type;
+    /*! @brief Allocators propagate on copy assignment. */
+    using propagate_on_container_copy_assignment = std::true_type;
+    /*! @brief Allocators propagate on move assignment. */
+    using propagate_on_container_move_assignment = std::true_type;
+    /*! @brief Allocators propagate on swap. */
+    using propagate_on_container_swap = std::true_type;
+
+    /**
+     * @brief Constructs an allocator for a given pool.
+     * @param ref A valid page pool.
+     */
+    page_allocator(page_pool &ref) noexcept
+        : pool{&ref} {}
+
+    /**
+     * @brief Constructs an allocator from another one.
+     * @tparam Other Type of objects allocated by the other allocator.
+     * @param other The allocator to copy the pool from.
+     */
+    template<typename Other>
+    page_allocator(const page_allocator<Other> &other) noexcept
+        : pool{other.pool} {}
+
+    /**
+     * @brief Allocates memory for a number of objects.
+     * @param length Number of objects to allocate memory for.
+     * @return A pointer to the allocated memory.
+     */
+    [[nodiscard]] Type *allocate(const std::size_t length) {
+        return static_cast<Type *>(pool->allocate(length * sizeof(Type), alignof(Type)));
+    }
+
+    /**
+     * @brief Returns memory to the pool.
+     * @param ptr A pointer previously returned by the allocator.
+     * @param length Number of objects the memory was allocated for.
+     */
+    void deallocate(Type *ptr, const std::size_t length) noexcept {
+        pool->deallocate(ptr, length * sizeof(Type), alignof(Type));
+    }
+
+    /**
+     * @brief Returns the underlying pool.
+     * @return The underlying pool.
+     */
+    [[nodiscard]] page_pool &resource() const noexcept {
+        return *pool;
+    }
+
+    /**
+     * @brief Checks if two allocators share the same pool.
+     * @tparam Other Type of objects allocated by the other allocator.
+     * @param other Allocator with which to compare.
+     * @return True if the two allocators share the same pool, false otherwise.
+     */
+    template<typename Other>
+    [[nodiscard]] bool operator==(const page_allocator<Other> &other) const noexcept {
+        return pool == other.pool;
+    }
+
+private:
+    page_pool *pool;
+};
+
 } // namespace entt
 
 #endif
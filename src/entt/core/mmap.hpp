@@ -0,0 +1,157 @@
+#ifndef ENTT_CORE_MMAP_HPP
+#define ENTT_CORE_MMAP_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include "../config/config.h"
+
+#if __has_include(<sys/mman.h>)
+#    include <sys/mman.h>
+#    define ENTT_HAS_MMAP
+#endif
+
+namespace entt {
+
+/*! @cond TURN_OFF_DOXYGEN */
+namespace internal {
+
+[[nodiscard]] inline void *map_pages([[maybe_unused]] const std::size_t length, [[maybe_unused]] const std::size_t align) {
+#ifdef ENTT_HAS_MMAP
+    // mappings are only aligned to base pages, over-map and trim head and tail
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast, performance-no-int-to-ptr)
+    if(void *ptr = ::mmap(nullptr, length + align, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0); ptr != MAP_FAILED) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        const auto first = reinterpret_cast<std::uintptr_t>(ptr);
+        const auto head = ((first + (align - 1u)) & ~(align - 1u)) - first;
+        auto *elem = static_cast<std::byte *>(ptr) + head;
+
+        if(head != 0u) {
+            ::munmap(ptr, head);
+        }
+
+        // the tail is never empty, head is always smaller than the alignment
+        ::munmap(elem + length, align - head);
+
+#    ifdef MADV_HUGEPAGE
+        // transparent huge pages are a hint, failures aren't errors
+        ::madvise(elem, length, MADV_HUGEPAGE);
+#    endif
+        return elem;
+    }
+
+    ENTT_THROW std::bad_alloc{};
+#endif
+    return nullptr;
+}
+
+inline void unmap_pages([[maybe_unused]] void *ptr, [[maybe_unused]] const std::size_t length) noexcept {
+#ifdef ENTT_HAS_MMAP
+    ::munmap(ptr, length);
+#endif
+}
+
+} // namespace internal
+/*! @endcond */
+
+/**
+ * @brief Allocator that maps large blocks of memory directly from the system.
+ *
+ * Blocks smaller than a huge page come from the global allocator. Larger blocks
+ * are rounded up to a multiple of the huge page size, mapped on demand at an
+ * address aligned to a huge page and backed by transparent huge pages where
+ * the platform supports them. This reduces TLB misses when iterating very
+ * large pools.<br/>
+ * On platforms without `mmap`, all blocks come from the global allocator.
+ *
+ * @tparam Type Type of objects to allocate.
+ */
+template<typename Type>
+class mmap_page_allocator {
+    static_assert(ENTT_HUGE_PAGE > 0 && (ENTT_HUGE_PAGE & (ENTT_HUGE_PAGE - 1)) == 0, "Huge page size must be a power of two");
+    static_assert(alignof(Type) <= ENTT_HUGE_PAGE, "Invalid alignment requirement");
+
+    using fallback_type = std::allocator<Type>;
+
+public:
+    /*! @brief Type of objects to allocate. */
+    using value_type = Type;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Allocators are stateless and always compare equal. */
+    using is_always_equal = std::true_type;
+
+    /*! @brief Size of huge pages in bytes. */
+    static constexpr size_type huge_page_size = ENTT_HUGE_PAGE;
+
+    /*! @brief Default constructor. */
+    constexpr mmap_page_allocator() noexcept = default;
+
+    /**
+     * @brief Constructs an allocator from another one.
+     * @tparam Other Type of objects allocated by the other allocator.
+     */
+    template<typename Other>
+    constexpr mmap_page_allocator(const mmap_page_allocator<Other> &) noexcept {}
+
+    /**
+     * @brief Checks if a block of the given size is mapped from the system.
+     * @param length Number of objects.
+     * @return True if the block is mapped from the system, false otherwise.
+     */
+    [[nodiscard]] static constexpr bool mapped(const size_type length) noexcept {
+#ifdef ENTT_HAS_MMAP
+        return (length * sizeof(Type)) >= huge_page_size;
+#else
+        return (static_cast<void>(length), false);
+#endif
+    }
+
+    /**
+     * @brief Allocates memory for a number of objects.
+     * @param length Number of objects to allocate memory for.
+     * @return A pointer to the allocated memory.
+     */
+    [[nodiscard]] Type *allocate(const size_type length) {
+        if(mapped(length)) {
+            return static_cast<Type *>(internal::map_pages(round_up(length), huge_page_size));
+        }
+
+        return fallback_type{}.allocate(length);
+    }
+
+    /**
+     * @brief Returns memory to the system.
+     * @param ptr A pointer previously returned by the allocator.
+     * @param length Number of objects the memory was allocated for.
+     */
+    void deallocate(Type *ptr, const size_type length) noexcept {
+        if(mapped(length)) {
+            // head and tail of the mapping were trimmed on allocation
+            internal::unmap_pages(ptr, round_up(length));
+        } else {
+            fallback_type{}.deallocate(ptr, length);
+        }
+    }
+
+    /**
+     * @brief Compares two allocators.
+     * @tparam Other Type of objects allocated by the other allocator.
+     * @return True, allocators are stateless.
+     */
+    template<typename Other>
+    [[nodiscard]] constexpr bool operator==(const mmap_page_allocator<Other> &) const noexcept {
+        return true;
+    }
+
+private:
+    [[nodiscard]] static constexpr size_type round_up(const size_type length) noexcept {
+        return (length * sizeof(Type) + (huge_page_size - 1u)) & ~(huge_page_size - 1u);
+    }
+};
+
+} // namespace entt
+
+#endif
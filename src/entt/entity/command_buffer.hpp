@@ -0,0 +1,386 @@
+#ifndef ENTT_ENTITY_COMMAND_BUFFER_HPP
+#define ENTT_ENTITY_COMMAND_BUFFER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "../container/dense_map.hpp"
+#include "../core/fwd.hpp"
+#include "../core/type_info.hpp"
+#include "../stl/functional.hpp"
+#include "component.hpp"
+#include "entity.hpp"
+#include "fwd.hpp"
+
+namespace entt {
+
+/**
+ * @brief Deferred command buffer for structural changes to a registry.
+ *
+ * Commands are recorded from any thread into arenas that are local to the
+ * calling thread, therefore recording doesn't require synchronization once a
+ * thread has its own arena. Entities created by means of a command buffer are
+ * _placeholders_ that are mapped to actual entities when the buffer is
+ * flushed.<br/>
+ * Flushing a buffer applies all commands in batch:
+ *
+ * * Placeholders are turned into actual entities first.
+ * * Commands are grouped by element type and each storage is touched once,
+ *   removals first and then additions. An addition followed by a removal of
+ *   the same element for the same entity is discarded, so that the last
+ *   recorded command wins.
+ * * Entities are destroyed last.
+ *
+ * The order in which commands are recorded is preserved only within the same
+ * batch and the same thread.
+ *
+ * @warning
+ * Flushing or clearing a buffer while other threads are recording commands
+ * results in undefined behavior.
+ *
+ * @tparam Registry Basic registry type.
+ */
+template<typename Registry>
+class basic_command_buffer final {
+    using traits_type = entt_traits<typename Registry::entity_type>;
+    static_assert(traits_type::version_mask != 0u, "Placeholders require a version");
+
+    struct base_pool {
+        base_pool() = default;
+        base_pool(const base_pool &) = delete;
+        base_pool(base_pool &&) = delete;
+        base_pool &operator=(const base_pool &) = delete;
+        base_pool &operator=(base_pool &&) = delete;
+        virtual ~base_pool() = default;
+
+        virtual void merge(base_pool &) = 0;
+        virtual void apply(Registry &, const std::vector<typename Registry::entity_type> &) = 0;
+        virtual void clear() noexcept = 0;
+    };
+
+    template<typename Type>
+    struct pool_type final: base_pool {
+        static constexpr bool has_value = (component_traits<Type, typename Registry::entity_type>::page_size != 0u);
+
+        void merge(base_pool &other) override {
+            auto &elem = static_cast<pool_type &>(other);
+
+            for(auto pos: elem.after) {
+                after.push_back(added.size() + pos);
+            }
+
+            added.insert(added.end(), elem.added.cbegin(), elem.added.cend());
+            removed.insert(removed.end(), elem.removed.cbegin(), elem.removed.cend());
+
+            if constexpr(has_value) {
+                values.insert(values.end(), std::make_move_iterator(elem.values.begin()), std::make_move_iterator(elem.values.end()));
+            }
+
+            elem.clear();
+        }
+
+        void discard() {
+            dense_map<typename Registry::entity_type, std::size_t> last{};
+            std::size_t next{};
+
+            // offsets are sorted, the last removal of an entity is the one that counts
+            for(std::size_t pos{}, end = removed.size(); pos < end; ++pos) {
+                last.insert_or_assign(removed[pos], after[pos]);
+            }
+
+            for(std::size_t pos{}, end = added.size(); pos < end; ++pos) {
+                if(const auto it = last.find(added[pos]); it == last.end() || !(pos < it->second)) {
+                    added[next] = added[pos];
+
+                    if constexpr(has_value) {
+                        values[next] = std::move(values[pos]);
+                    }
+
+                    ++next;
+                }
+            }
+
+            added.erase(added.begin() + static_cast<std::ptrdiff_t>(next), added.end());
+
+            if constexpr(has_value) {
+                values.erase(values.begin() + static_cast<std::ptrdiff_t>(next), values.end());
+            }
+        }
+
+        void apply(Registry &reg, const std::vector<typename Registry::entity_type> &created) override {
+            if(!removed.empty() && !added.empty()) {
+                discard();
+            }
+
+            if(!removed.empty()) {
+                resolve(removed, created);
+                reg.template remove<Type>(removed.begin(), removed.end());
+            }
+
+            if(!added.empty()) {
+                resolve(added, created);
+
+                if constexpr(has_value) {
+                    reg.template insert<Type>(added.begin(), added.end(), std::make_move_iterator(values.begin()));
+                } else {
+                    reg.template insert<Type>(added.begin(), added.end());
+                }
+            }
+        }
+
+        void clear() noexcept override {
+            added.clear();
+            removed.clear();
+            after.clear();
+            values.clear();
+        }
+
+        std::vector<typename Registry::entity_type> added{};
+        std::vector<typename Registry::entity_type> removed{};
+        // number of additions recorded before each removal
+        std::vector<std::size_t> after{};
+        std::vector<Type> values{};
+    };
+
+    struct arena_type {
+        std::thread::id owner{};
+        dense_map<id_type, std::unique_ptr<base_pool>, stl::identity, std::equal_to<>> pools{};
+        std::vector<typename Registry::entity_type> destroyed{};
+    };
+
+    struct cache_type {
+        std::size_t instance{};
+        arena_type *arena{};
+    };
+
+    static void resolve(std::vector<typename Registry::entity_type> &range, const std::vector<typename Registry::entity_type> &created) {
+        for(auto &&entt: range) {
+            if(placeholder(entt)) {
+                ENTT_ASSERT(static_cast<std::size_t>(traits_type::to_entity(entt)) < created.size(), "Invalid placeholder");
+                entt = created[static_cast<std::size_t>(traits_type::to_entity(entt))];
+            }
+        }
+    }
+
+    [[nodiscard]] static std::size_t next_instance() noexcept {
+        static std::atomic<std::size_t> counter{};
+        return ++counter;
+    }
+
+    [[nodiscard]] arena_type &local() {
+        static thread_local cache_type cache{};
+
+        if(cache.instance != instance) {
+            const std::lock_guard lock{mutex};
+            const auto id = std::this_thread::get_id();
+            auto it = arenas.begin();
+
+            for(const auto last = arenas.end(); it != last && (*it)->owner != id; ++it) {}
+
+            if(it == arenas.end()) {
+                arenas.push_back(std::make_unique<arena_type>());
+                arenas.back()->owner = id;
+                it = std::prev(arenas.end());
+            }
+
+            cache = {instance, it->get()};
+        }
+
+        return *cache.arena;
+    }
+
+    template<typename Type>
+    [[nodiscard]] pool_type<Type> &assure() {
+        static_assert(std::is_same_v<Type, std::decay_t<Type>>, "Non-decayed types not allowed");
+        auto &elem = local().pools[type_hash<Type>::value()];
+
+        if(!elem) {
+            elem = std::make_unique<pool_type<Type>>();
+        }
+
+        return static_cast<pool_type<Type> &>(*elem);
+    }
+
+public:
+    /*! Basic registry type. */
+    using registry_type = Registry;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = registry_type::entity_type;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /*! @brief Default constructor. */
+    basic_command_buffer()
+        : arenas{},
+          created{},
+          count{},
+          instance{next_instance()},
+          mutex{} {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_command_buffer(const basic_command_buffer &) = delete;
+
+    /*! @brief Default move constructor, deleted on purpose. */
+    basic_command_buffer(basic_command_buffer &&) = delete;
+
+    /*! @brief Default destructor. */
+    ~basic_command_buffer() = default;
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This command buffer.
+     */
+    basic_command_buffer &operator=(const basic_command_buffer &) = delete;
+
+    /**
+     * @brief Default move assignment operator, deleted on purpose.
+     * @return This command buffer.
+     */
+    basic_command_buffer &operator=(basic_command_buffer &&) = delete;
+
+    /**
+     * @brief Checks if an identifier is a placeholder.
+     * @param entt An identifier, either valid or not.
+     * @return True if the identifier is a placeholder, false otherwise.
+     */
+    [[nodiscard]] static bool placeholder(const entity_type entt) noexcept {
+        return (entt == tombstone) && (entt != null);
+    }
+
+    /**
+     * @brief Creates a placeholder to replace with an actual entity on flush.
+     * @return A placeholder that is unique within the command buffer.
+     */
+    [[nodiscard]] entity_type create() {
+        const auto pos = count.fetch_add(1u, std::memory_order_relaxed);
+        ENTT_ASSERT(pos < traits_type::to_entity(null), "No placeholders available");
+        return traits_type::combine(static_cast<traits_type::entity_type>(pos), tombstone);
+    }
+
+    /**
+     * @brief Records the construction of an element for an entity.
+     *
+     * The element is constructed immediately and moved into the storage on
+     * flush.
+     *
+     * @warning
+     * Attempting to assign an element to an entity that already owns it on
+     * flush results in undefined behavior.
+     *
+     * @tparam Type Type of element to create.
+     * @tparam Args Types of arguments to use to construct the element.
+     * @param entt A valid identifier or a placeholder.
+     * @param args Parameters to use to initialize the element.
+     */
+    template<typename Type, typename... Args>
+    void emplace(const entity_type entt, Args &&...args) {
+        auto &elem = assure<Type>();
+        elem.added.push_back(entt);
+
+        if constexpr(pool_type<Type>::has_value) {
+            elem.values.emplace_back(std::forward<Args>(args)...);
+        }
+    }
+
+    /**
+     * @brief Records the removal of the given elements from an entity.
+     * @tparam Type Types of elements to remove.
+     * @param entt A valid identifier or a placeholder.
+     */
+    template<typename... Type>
+    void remove(const entity_type entt) {
+        ([entt](auto &elem) {
+            elem.removed.push_back(entt);
+            elem.after.push_back(elem.added.size());
+        }(assure<Type>()),
+         ...);
+    }
+
+    /**
+     * @brief Records the destruction of an entity.
+     * @param entt A valid identifier or a placeholder.
+     */
+    void destroy(const entity_type entt) {
+        local().destroyed.push_back(entt);
+    }
+
+    /**
+     * @brief Discards all commands recorded so far.
+     *
+     * Memory is retained by the thread local arenas for later use.
+     */
+    void clear() noexcept {
+        for(auto &&arena: arenas) {
+            for(auto &&elem: arena->pools) {
+                // pools are moved to the first arena on flush when possible
+                if(elem.second) {
+                    elem.second->clear();
+                }
+            }
+
+            arena->destroyed.clear();
+        }
+
+        count.store(0u, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Applies all commands recorded so far to a registry.
+     *
+     * Commands are discarded once applied and placeholders become invalid.
+     *
+     * @param reg A valid registry.
+     */
+    void flush(registry_type &reg) {
+        created.resize(count.load(std::memory_order_relaxed));
+        reg.create(created.begin(), created.end());
+
+        if(!arenas.empty()) {
+            auto &target = *arenas.front();
+
+            for(auto first = std::next(arenas.begin()), last = arenas.end(); first != last; ++first) {
+                for(auto &&elem: (*first)->pools) {
+                    if(elem.second) {
+                        if(auto &pool = target.pools[elem.first]; pool) {
+                            pool->merge(*elem.second);
+                        } else {
+                            pool.swap(elem.second);
+                        }
+                    }
+                }
+
+                target.destroyed.insert(target.destroyed.end(), (*first)->destroyed.cbegin(), (*first)->destroyed.cend());
+            }
+
+            for(auto &&elem: target.pools) {
+                if(elem.second) {
+                    elem.second->apply(reg, created);
+                }
+            }
+
+            resolve(target.destroyed, created);
+            reg.destroy(target.destroyed.begin(), target.destroyed.end());
+        }
+
+        clear();
+    }
+
+private:
+    std::vector<std::unique_ptr<arena_type>> arenas;
+    std::vector<entity_type> created;
+    std::atomic<size_type> count;
+    size_type instance;
+    std::mutex mutex;
+};
+
+} // namespace entt
+
+#endif
@@ -3,9 +3,11 @@
 
 #include <concepts>
 #include <cstddef>
+#include <limits>
 #include <type_traits>
 #include "../config/config.h"
 #include "../core/concepts.hpp"
+#include "../core/type_traits.hpp"
 #include "fwd.hpp"
 
 namespace entt {
@@ -33,9 +35,43 @@ template<typename Type>
 requires std::is_convertible_v<decltype(Type::page_size), std::size_t>
 struct page_size<Type>: std::integral_constant<std::size_t, Type::page_size> {};
 
+template<typename Type>
+struct page_alignment: std::integral_constant<std::size_t, alignof(Type)> {};
+
+template<>
+struct page_alignment<void>: std::integral_constant<std::size_t, 0u> {};
+
+template<typename Type>
+requires std::is_convertible_v<decltype(Type::page_alignment), std::size_t>
+struct page_alignment<Type>: std::integral_constant<std::size_t, Type::page_alignment> {};
+
+template<typename Type>
+struct prefetch_distance: std::integral_constant<std::size_t, 0u> {};
+
+template<typename Type>
+requires std::is_convertible_v<decltype(Type::prefetch_distance), std::size_t>
+struct prefetch_distance<Type>: std::integral_constant<std::size_t, Type::prefetch_distance> {};
+
+template<typename Type>
+struct bitset_tag: std::false_type {};
+
+template<typename Type>
+requires std::is_convertible_v<decltype(Type::bitset_tag), bool>
+struct bitset_tag<Type>: std::bool_constant<Type::bitset_tag> {};
+
+template<typename Type>
+struct columns: value_list<> {};
+
+template<typename Type>
+requires requires { typename Type::columns; }
+struct columns<Type>: Type::columns {};
+
 } // namespace internal
 /*! @endcond */
 
+/*! @brief Page size to use to store elements in a single contiguous array. */
+inline constexpr std::size_t no_pagination = (std::numeric_limits<std::size_t>::max)();
+
 /**
  * @brief Common way to access various properties of components.
  * @tparam Type Element type.
@@ -52,6 +88,41 @@ struct component_traits {
     static constexpr bool in_place_delete = internal::in_place_delete<Type>::value;
     /*! @brief Page size, default is `ENTT_PACKED_PAGE` for non-empty types. */
     static constexpr std::size_t page_size = internal::page_size<Type>::value;
+    /*! @brief Alignment of pages, default is the alignment of the type. */
+    static constexpr std::size_t page_alignment = internal::page_alignment<Type>::value;
+    /*! @brief Entities to look ahead when iterating views, default is none. */
+    static constexpr std::size_t prefetch_distance = internal::prefetch_distance<Type>::value;
+    /*! @brief Membership tracked by a bitset, empty types only, default is `false`. */
+    static constexpr bool bitset_tag = internal::bitset_tag<Type>::value;
+    /**
+     * @brief Data members stored in separate columns, default is none.
+     *
+     * Columns must list all data members of the type. This is enforced at
+     * compile-time for aggregates only. Members that non-aggregate types do
+     * not list are silently dropped when elements are inserted.
+     */
+    using columns = internal::columns<Type>::type;
+};
+
+/**
+ * @brief Common way to access various properties of blobs.
+ *
+ * Blobs aren't paged. The page size only drives chunk based iterations.
+ *
+ * @tparam Type Type of elements in the sequences.
+ * @tparam Entity A valid entity type.
+ */
+template<typename Type, typename Entity>
+struct component_traits<blob_t<Type>, Entity> {
+    /*! @brief Element type. */
+    using element_type = blob_t<Type>;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+
+    /*! @brief Pointer stability, not supported by blobs. */
+    static constexpr bool in_place_delete = false;
+    /*! @brief Page size, default is `ENTT_PACKED_PAGE`. */
+    static constexpr std::size_t page_size = ENTT_PACKED_PAGE;
 };
 
 } // namespace entt
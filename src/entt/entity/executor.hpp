@@ -0,0 +1,181 @@
+#ifndef ENTT_ENTITY_EXECUTOR_HPP
+#define ENTT_ENTITY_EXECUTOR_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <vector>
+#include "../config/config.h"
+#include "../core/job_system.hpp"
+#include "fwd.hpp"
+#include "organizer.hpp"
+
+namespace entt {
+
+/**
+ * @brief Parallel executor for task graphs generated by an organizer.
+ *
+ * The executor runs the vertices of a task graph as jobs of a job system. A
+ * vertex is submitted as soon as all its in-edges are satisfied, therefore
+ * tasks that only share read-only resources run concurrently while conflicting
+ * ones (including sync points that access the registry in read-write mode) are
+ * serialized according to the graph.
+ *
+ * @tparam Registry Basic registry type.
+ */
+template<typename Registry>
+class basic_executor final {
+    using organizer_type = basic_organizer<Registry>;
+
+    struct task_data {
+        basic_executor *owner{};
+        std::size_t index{};
+        std::atomic<std::size_t> pending{};
+        std::optional<job> handle{};
+    };
+
+    void release(const std::size_t index) {
+        for(auto next: (*graph)[index].out_edges()) {
+            if(auto &other = tasks[next]; other.pending.fetch_sub(1u, std::memory_order_acq_rel) == 1u) {
+                jobs->submit(*other.handle);
+            }
+        }
+    }
+
+    static void dispatch(const void *payload) {
+        auto &task = *static_cast<task_data *>(const_cast<void *>(payload));
+        auto &self = *task.owner;
+
+        if(!self.failure.load(std::memory_order_acquire)) {
+            const auto &vertex = (*self.graph)[task.index];
+
+            ENTT_TRY {
+                vertex.callback()(vertex.data(), *self.target);
+            }
+            ENTT_CATCH {
+                // the failure is visible before successors (children of the root job) are released
+                self.failure.store(true, std::memory_order_release);
+                self.release(task.index);
+                ENTT_THROW;
+            }
+        }
+
+        self.release(task.index);
+    }
+
+    static void launch(const void *payload) {
+        auto &self = *static_cast<basic_executor *>(const_cast<void *>(payload));
+
+        for(std::size_t pos{}, last = self.graph->size(); pos < last; ++pos) {
+            if((*self.graph)[pos].top_level()) {
+                self.jobs->submit(*self.tasks[pos].handle);
+            }
+        }
+    }
+
+public:
+    /*! Basic registry type. */
+    using registry_type = Registry;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Vertex type of the task graphs accepted by the executor. */
+    using vertex_type = organizer_type::vertex;
+
+    /**
+     * @brief Constructs an executor on top of a job system.
+     * @param system The job system to use to run the tasks.
+     */
+    explicit basic_executor(job_system &system) noexcept
+        : jobs{&system},
+          tasks{},
+          length{} {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_executor(const basic_executor &) = delete;
+
+    /*! @brief Default move constructor, deleted on purpose. */
+    basic_executor(basic_executor &&) = delete;
+
+    /*! @brief Default destructor. */
+    ~basic_executor() = default;
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This executor.
+     */
+    basic_executor &operator=(const basic_executor &) = delete;
+
+    /**
+     * @brief Default move assignment operator, deleted on purpose.
+     * @return This executor.
+     */
+    basic_executor &operator=(basic_executor &&) = delete;
+
+    /**
+     * @brief Returns the maximum number of tasks that run concurrently.
+     * @return The level of concurrency of the executor.
+     */
+    [[nodiscard]] size_type concurrency() const noexcept {
+        return jobs->concurrency();
+    }
+
+    /**
+     * @brief Runs a task graph and waits for all its vertices to complete.
+     *
+     * All vertices are prepared on the calling thread before running any task,
+     * so that no pool or context variable is created concurrently.<br/>
+     * The calling thread takes part in the execution of the graph. If a task
+     * throws, none of the tasks that are not yet started is invoked and the
+     * first exception is rethrown once the graph is drained.
+     *
+     * @warning
+     * Running multiple task graphs concurrently on the same executor results in
+     * undefined behavior.
+     *
+     * @param adjacency_list The task graph to run.
+     * @param reg A valid registry.
+     */
+    void run(const std::vector<vertex_type> &adjacency_list, registry_type &reg) {
+        if(adjacency_list.empty()) {
+            return;
+        }
+
+        for(auto &&vertex: adjacency_list) {
+            vertex.prepare(reg);
+        }
+
+        if(length < adjacency_list.size()) {
+            length = adjacency_list.size();
+            tasks = std::make_unique<task_data[]>(length);
+        }
+
+        job parent{&launch, this};
+        graph = &adjacency_list;
+        target = &reg;
+        failure.store(false, std::memory_order_relaxed);
+
+        for(size_type pos{}, last = adjacency_list.size(); pos < last; ++pos) {
+            auto &task = tasks[pos];
+            task.owner = this;
+            task.index = pos;
+            task.pending.store(adjacency_list[pos].in_edges().size(), std::memory_order_relaxed);
+            task.handle.emplace(&dispatch, &task, &parent);
+        }
+
+        jobs->submit(parent);
+        jobs->wait(parent);
+    }
+
+private:
+    job_system *jobs;
+    std::unique_ptr<task_data[]> tasks;
+    size_type length;
+    const std::vector<vertex_type> *graph{};
+    registry_type *target{};
+    std::atomic<bool> failure{};
+};
+
+} // namespace entt
+
+#endif
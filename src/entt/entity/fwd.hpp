@@ -53,9 +53,18 @@ class basic_runtime_view;
 template<typename, typename, typename>
 class basic_group;
 
+template<typename>
+class basic_runtime_group;
+
 template<typename>
 class basic_organizer;
 
+template<typename>
+class basic_executor;
+
+template<typename>
+class basic_command_buffer;
+
 template<typename, typename...>
 class basic_handle;
 
@@ -98,6 +107,12 @@ using registry = basic_registry<>;
 /*! @brief Alias declaration for the most common use case. */
 using organizer = basic_organizer<registry>;
 
+/*! @brief Alias declaration for the most common use case. */
+using executor = basic_executor<registry>;
+
+/*! @brief Alias declaration for the most common use case. */
+using command_buffer = basic_command_buffer<registry>;
+
 /*! @brief Alias declaration for the most common use case. */
 using handle = basic_handle<registry>;
 
@@ -133,6 +148,12 @@ using runtime_view = basic_runtime_view<sparse_set>;
 /*! @brief Alias declaration for the most common use case. */
 using const_runtime_view = basic_runtime_view<const sparse_set>;
 
+/*! @brief Alias declaration for the most common use case. */
+using runtime_group = basic_runtime_group<sparse_set>;
+
+/*! @brief Alias declaration for the most common use case. */
+using const_runtime_group = basic_runtime_group<const sparse_set>;
+
 /**
  * @brief Alias for exclusion lists.
  * @tparam Type List of types.
@@ -184,6 +205,18 @@ struct owned_t final: type_list<Type...> {
 template<typename... Type>
 inline constexpr owned_t<Type...> owned{};
 
+/**
+ * @brief Alias for variable length sequences of elements of a given type.
+ * @tparam Type Type of elements.
+ */
+template<typename Type>
+struct blob_t final {
+    /*! @brief Type of elements. */
+    using type = Type;
+    /*! @brief Default constructor. */
+    explicit ENTT_CONSTEVAL blob_t() = default;
+};
+
 /**
  * @brief Applies a given _function_ to a get list and generate a new list.
  * @tparam Type Types provided by the get list.
@@ -1,13 +1,16 @@
 #ifndef ENTT_ENTITY_GROUP_HPP
 #define ENTT_ENTITY_GROUP_HPP
 
+#include <algorithm>
 #include <array>
 #include <concepts>
 #include <cstddef>
 #include <iterator>
+#include <memory>
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 #include "../config/config.h"
 #include "../core/algorithm.hpp"
 #include "../core/fwd.hpp"
@@ -17,6 +20,7 @@
 #include "../stl/iterator.hpp"
 #include "entity.hpp"
 #include "fwd.hpp"
+#include "view.hpp"
 
 namespace entt {
 
@@ -33,7 +37,8 @@ class extended_group_iterator<It, owned_t<Owned...>, get_t<Get...>> {
         if constexpr(std::is_void_v<typename Type::value_type>) {
             return std::make_tuple();
         } else {
-            return std::forward_as_tuple(cpool.rbegin()[it.index()]);
+            // proxy references are returned by value
+            return std::tuple<decltype(cpool.rbegin()[it.index()])>{cpool.rbegin()[it.index()]};
         }
     }
 
@@ -85,16 +90,34 @@ private:
     std::tuple<Owned *..., Get *...> pools;
 };
 
+template<typename Type>
 struct group_descriptor {
     using size_type = std::size_t;
     virtual ~group_descriptor() = default;
-    [[nodiscard]] virtual bool owned(const id_type) const noexcept {
+    // pools are matched by identity, named storage of the same type are unrelated
+    [[nodiscard]] virtual bool owned(const Type *) const noexcept {
         return false;
     }
+    virtual void reserve(const size_type) {}
+};
+
+template<typename Type>
+struct nested_group_descriptor: group_descriptor<Type> {
+    using entity_type = Type::entity_type;
+    [[nodiscard]] virtual bool get(const Type *) const noexcept = 0;
+    [[nodiscard]] virtual bool exclude(const Type *) const noexcept = 0;
+    [[nodiscard]] virtual bool overlaps(const group_descriptor<Type> &) const noexcept = 0;
+    // true if the storage of this group are part of the other group with the same role
+    [[nodiscard]] virtual bool nested(const nested_group_descriptor &) const noexcept = 0;
+    // outer groups are always updated before inner ones on insertion and after them on removal
+    virtual void push(const entity_type) = 0;
+    virtual void pop(const entity_type) = 0;
+    nested_group_descriptor *outer{};
+    nested_group_descriptor *inner{};
 };
 
 template<typename Type, std::size_t Owned, std::size_t Get, std::size_t Exclude>
-class group_handler final: public group_descriptor {
+class group_handler final: public nested_group_descriptor<Type> {
     using entity_type = Type::entity_type;
 
     void swap_elements(const std::size_t pos, const entity_type entt) {
@@ -106,21 +129,19 @@ class group_handler final: public group_descriptor {
     void push_on_construct(const entity_type entt) {
         if(std::apply([entt, pos = len](auto *cpool, auto *...other) { return cpool->contains(entt) && !(cpool->index(entt) < pos) && (other->contains(entt) && ...); }, pools)
            && std::apply([entt](auto *...cpool) { return (!cpool->contains(entt) && ...); }, filter)) {
-            swap_elements(len++, entt);
+            push(entt);
         }
     }
 
     void push_on_destroy(const entity_type entt) {
         if(std::apply([entt, pos = len](auto *cpool, auto *...other) { return cpool->contains(entt) && !(cpool->index(entt) < pos) && (other->contains(entt) && ...); }, pools)
            && std::apply([entt](auto *...cpool) { return (0u + ... + cpool->contains(entt)) == 1u; }, filter)) {
-            swap_elements(len++, entt);
+            push(entt);
         }
     }
 
     void remove_if(const entity_type entt) {
-        if(pools[0u]->contains(entt) && (pools[0u]->index(entt) < len)) {
-            swap_elements(--len, entt);
-        }
+        pop(entt);
     }
 
     void common_setup() {
@@ -143,14 +164,46 @@ public:
         common_setup();
     }
 
-    [[nodiscard]] bool owned(const id_type hash) const noexcept override {
-        for(size_type pos{}; pos < Owned; ++pos) {
-            if(pools[pos]->info().hash() == hash) {
-                return true;
+    [[nodiscard]] bool owned(const common_type *other) const noexcept override {
+        return std::find(pools.cbegin(), pools.cbegin() + Owned, other) != (pools.cbegin() + Owned);
+    }
+
+    [[nodiscard]] bool get(const common_type *other) const noexcept override {
+        return std::find(pools.cbegin() + Owned, pools.cend(), other) != pools.cend();
+    }
+
+    [[nodiscard]] bool exclude(const common_type *other) const noexcept override {
+        return std::find(filter.cbegin(), filter.cend(), other) != filter.cend();
+    }
+
+    [[nodiscard]] bool overlaps(const group_descriptor<Type> &other) const noexcept override {
+        return std::any_of(pools.cbegin(), pools.cbegin() + Owned, [&other](const auto *cpool) { return other.owned(cpool); });
+    }
+
+    [[nodiscard]] bool nested(const nested_group_descriptor<Type> &other) const noexcept override {
+        return std::all_of(pools.cbegin(), pools.cbegin() + Owned, [&other](const auto *cpool) { return other.owned(cpool); })
+               && std::all_of(pools.cbegin() + Owned, pools.cend(), [&other](const auto *cpool) { return other.get(cpool); })
+               && std::all_of(filter.cbegin(), filter.cend(), [&other](const auto *cpool) { return other.exclude(cpool); });
+    }
+
+    void push(const entity_type entt) override {
+        if(!(pools[0u]->index(entt) < len)) {
+            if(this->outer) {
+                this->outer->push(entt);
             }
+
+            swap_elements(len++, entt);
         }
+    }
 
-        return false;
+    void pop(const entity_type entt) override {
+        if(pools[0u]->contains(entt) && (pools[0u]->index(entt) < len)) {
+            if(this->inner) {
+                this->inner->pop(entt);
+            }
+
+            swap_elements(--len, entt);
+        }
     }
 
     [[nodiscard]] size_type length() const noexcept {
@@ -173,7 +226,7 @@ private:
 };
 
 template<typename Type, std::size_t Get, std::size_t Exclude>
-class group_handler<Type, 0u, Get, Exclude> final: public group_descriptor {
+class group_handler<Type, 0u, Get, Exclude> final: public group_descriptor<Type> {
     using entity_type = Type::entity_type;
 
     void push_on_construct(const entity_type entt) {
@@ -204,6 +257,7 @@ class group_handler<Type, 0u, Get, Exclude> final: public group_descriptor {
 
 public:
     using common_type = Type;
+    using size_type = Type::size_type;
 
     template<typename Allocator, typename... GType, typename... EType>
     group_handler(const Allocator &allocator, std::tuple<GType &...> gpool, std::tuple<EType &...> epool)
@@ -215,6 +269,11 @@ public:
         common_setup();
     }
 
+    void reserve(const size_type cap) override {
+        elem.reserve(cap);
+        elem.reserve_extent(cap);
+    }
+
     [[nodiscard]] common_type &handle() noexcept {
         return elem;
     }
@@ -238,6 +297,159 @@ private:
     common_type elem;
 };
 
+template<typename Type>
+class runtime_group_handler final: public nested_group_descriptor<Type> {
+    using entity_type = Type::entity_type;
+    using alloc_traits = std::allocator_traits<typename Type::allocator_type>;
+
+    [[nodiscard]] bool candidate(const entity_type entt) const {
+        if(owned_count == 0u) {
+            return !elem.contains(entt) && std::all_of(pools.cbegin(), pools.cend(), [entt](const auto *cpool) { return cpool->contains(entt); });
+        }
+
+        return pools[0u]->contains(entt) && !(pools[0u]->index(entt) < len) && std::all_of(pools.cbegin() + 1, pools.cend(), [entt](const auto *cpool) { return cpool->contains(entt); });
+    }
+
+    void swap_elements(const std::size_t pos, const entity_type entt) {
+        for(size_type next{}; next < owned_count; ++next) {
+            pools[next]->swap_elements((*pools[next])[pos], entt);
+        }
+    }
+
+    [[nodiscard]] auto owned_end() const noexcept {
+        return pools.cbegin() + static_cast<typename container_type::difference_type>(owned_count);
+    }
+
+    void push_on_construct(const entity_type entt) {
+        if(candidate(entt) && std::none_of(filter.cbegin(), filter.cend(), [entt](const auto *cpool) { return cpool->contains(entt); })) {
+            push(entt);
+        }
+    }
+
+    void push_on_destroy(const entity_type entt) {
+        if(candidate(entt) && std::count_if(filter.cbegin(), filter.cend(), [entt](const auto *cpool) { return cpool->contains(entt); }) == 1) {
+            push(entt);
+        }
+    }
+
+    void remove_if(const entity_type entt) {
+        pop(entt);
+    }
+
+    void common_setup() {
+        // we cannot iterate backwards because we want to leave behind valid entities in case of owned types
+        for(auto first = pools[0u]->rbegin(), last = first + static_cast<typename Type::difference_type>(pools[0u]->size()); first != last; ++first) {
+            push_on_construct(*first);
+        }
+    }
+
+public:
+    using common_type = Type;
+    using size_type = Type::size_type;
+    using allocator_type = Type::allocator_type;
+    using container_type = std::vector<common_type *, typename alloc_traits::template rebind_alloc<common_type *>>;
+    using hook_type = void (*)(common_type &, runtime_group_handler &, bool);
+
+    template<typename Storage>
+    static void connect(common_type &base, runtime_group_handler &self, const bool excluded) {
+        auto &cpool = static_cast<Storage &>(base);
+
+        if(excluded) {
+            cpool.on_construct().template connect<&runtime_group_handler::remove_if>(self);
+            cpool.on_destroy().template connect<&runtime_group_handler::push_on_destroy>(self);
+        } else {
+            cpool.on_construct().template connect<&runtime_group_handler::push_on_construct>(self);
+            cpool.on_destroy().template connect<&runtime_group_handler::remove_if>(self);
+        }
+    }
+
+    runtime_group_handler(const allocator_type &allocator, const size_type count, container_type ogpool, container_type epool)
+        : pools{std::move(ogpool)},
+          filter{std::move(epool)},
+          elem{allocator},
+          owned_count{count} {
+        ENTT_ASSERT(!pools.empty() && !(pools.size() < owned_count), "Invalid group");
+        ENTT_ASSERT(std::none_of(pools.cbegin(), owned_end(), [](const auto *cpool) { return cpool->policy() == deletion_policy::in_place; }), "Groups do not support in-place delete");
+        common_setup();
+    }
+
+    [[nodiscard]] bool owned(const common_type *other) const noexcept override {
+        return std::find(pools.cbegin(), owned_end(), other) != owned_end();
+    }
+
+    [[nodiscard]] bool get(const common_type *other) const noexcept override {
+        return std::find(owned_end(), pools.cend(), other) != pools.cend();
+    }
+
+    [[nodiscard]] bool exclude(const common_type *other) const noexcept override {
+        return std::find(filter.cbegin(), filter.cend(), other) != filter.cend();
+    }
+
+    [[nodiscard]] bool overlaps(const group_descriptor<Type> &other) const noexcept override {
+        return std::any_of(pools.cbegin(), owned_end(), [&other](const auto *cpool) { return other.owned(cpool); });
+    }
+
+    [[nodiscard]] bool nested(const nested_group_descriptor<Type> &other) const noexcept override {
+        return std::all_of(pools.cbegin(), owned_end(), [&other](const auto *cpool) { return other.owned(cpool); })
+               && std::all_of(owned_end(), pools.cend(), [&other](const auto *cpool) { return other.get(cpool); })
+               && std::all_of(filter.cbegin(), filter.cend(), [&other](const auto *cpool) { return other.exclude(cpool); });
+    }
+
+    void push(const entity_type entt) override {
+        if(owned_count == 0u) {
+            elem.push(entt);
+        } else if(!(pools[0u]->index(entt) < len)) {
+            if(this->outer) {
+                this->outer->push(entt);
+            }
+
+            swap_elements(len++, entt);
+        }
+    }
+
+    void pop(const entity_type entt) override {
+        if(owned_count == 0u) {
+            elem.remove(entt);
+        } else if(pools[0u]->contains(entt) && (pools[0u]->index(entt) < len)) {
+            if(this->inner) {
+                this->inner->pop(entt);
+            }
+
+            swap_elements(--len, entt);
+        }
+    }
+
+    void reserve(const size_type cap) override {
+        if(owned_count == 0u) {
+            elem.reserve(cap);
+            elem.reserve_extent(cap);
+        }
+    }
+
+    [[nodiscard]] size_type length() const noexcept {
+        return (owned_count == 0u) ? elem.size() : len;
+    }
+
+    [[nodiscard]] const common_type &handle() const noexcept {
+        return (owned_count == 0u) ? elem : *pools[0u];
+    }
+
+    [[nodiscard]] size_type count() const noexcept {
+        return pools.size() + filter.size();
+    }
+
+    [[nodiscard]] common_type *storage(const size_type pos) const noexcept {
+        return (pos < pools.size()) ? pools[pos] : filter[pos - pools.size()];
+    }
+
+private:
+    container_type pools;
+    container_type filter;
+    common_type elem;
+    size_type owned_count;
+    size_type len{};
+};
+
 } // namespace internal
 /*! @endcond */
 
@@ -666,7 +878,9 @@ private:
  * * They stay true to the order of the owned storage and all instances have the
  *   same order in memory.
  *
- * The more types of storage are owned, the faster it is to iterate a group.
+ * The more types of storage are owned, the faster it is to iterate a group.<br/>
+ * Owning groups share the ownership of their storage only with groups that are
+ * nested into them or into which they are nested.
  *
  * @b Important
  *
@@ -700,6 +914,15 @@ class basic_group<owned_t<Owned...>, get_t<Get...>, exclude_t<Exclude...>> {
         return descriptor ? return_type{static_cast<Owned *>(descriptor->template storage<Index>())..., static_cast<Get *>(descriptor->template storage<sizeof...(Owned) + Other>())...} : return_type{};
     }
 
+    template<typename Func, typename Args>
+    void visit(Func &func, Args &&args) const {
+        if constexpr(is_applicable_v<Func, decltype(std::tuple_cat(std::tuple<entity_type>{}, std::declval<basic_group>().get({})))>) {
+            std::apply(func, std::forward<Args>(args));
+        } else {
+            std::apply([&func](auto, auto &&...less) { func(std::forward<decltype(less)>(less)...); }, std::forward<Args>(args));
+        }
+    }
+
 public:
     /*! @brief Underlying entity identifier. */
     using entity_type = underlying_type;
@@ -715,6 +938,8 @@ public:
     using reverse_iterator = common_type::reverse_iterator;
     /*! @brief Iterable group type. */
     using iterable = iterable_adaptor<internal::extended_group_iterator<iterator, owned_t<Owned...>, get_t<Get...>>>;
+    /*! @brief Iterable chunk type. */
+    using chunk_iterable = iterable_adaptor<internal::chunk_iterator<entity_type, Owned...>>;
     /*! @brief Group handler type. */
     using handler = internal::group_handler<common_type, sizeof...(Owned), sizeof...(Get), sizeof...(Exclude)>;
 
@@ -936,11 +1161,7 @@ public:
     template<typename Func>
     void each(Func func) const {
         for(auto args: each()) {
-            if constexpr(is_applicable_v<Func, decltype(std::tuple_cat(std::tuple<entity_type>{}, std::declval<basic_group>().get({})))>) {
-                std::apply(func, args);
-            } else {
-                std::apply([&func](auto, auto &&...less) { func(std::forward<decltype(less)>(less)...); }, args);
-            }
+            visit(func, args);
         }
     }
 
@@ -962,6 +1183,89 @@ public:
         return iterable{{begin(), cpools}, {end(), cpools}};
     }
 
+    /**
+     * @brief Iterates entities and elements in parallel and applies the given
+     * function object to them.
+     *
+     * Owned storage are aligned, therefore the group is split in page aligned
+     * chunks that are distributed among the threads of the executor without
+     * any further membership check. Any type that offers a `parallel_for`
+     * member function, such as a job system, is a valid executor.<br/>
+     * The signature of the function is the same as for `each`. However, the
+     * function is invoked concurrently from multiple threads and the order of
+     * the visit is unspecified.
+     *
+     * @warning
+     * Entities and elements must not be created or destroyed during iteration.
+     *
+     * @tparam Executor Type of executor to use to run the chunks.
+     * @tparam Func Type of the function object to invoke.
+     * @param jobs A valid executor.
+     * @param func A valid function object.
+     */
+    template<typename Executor, typename Func>
+    void par_each(Executor &jobs, Func func) const {
+        using chunk_iterator = chunk_iterable::iterator;
+        constexpr size_type page_size = ENTT_PACKED_PAGE;
+
+        if(const auto length = size(); length != 0u) {
+            const auto cpools = pools_for(std::index_sequence_for<Owned...>{}, std::index_sequence_for<Get...>{});
+            const auto last = end();
+
+            jobs.parallel_for(chunk_iterator::count(length, page_size), [this, &func, &cpools, last, length](const size_type pos) {
+                const auto [from, to] = chunk_iterator::range(pos, length, page_size);
+
+                // groups visit owned storage backwards
+                for(typename iterable::iterator it{last - static_cast<difference_type>(to), cpools}, sentinel{last - static_cast<difference_type>(from), cpools}; it != sentinel; ++it) {
+                    visit(func, *it);
+                }
+            });
+        }
+    }
+
+    /**
+     * @brief Returns an iterable object to use to split a group in chunks.
+     *
+     * Each chunk is a tuple that contains a span of entities and a span of
+     * non-empty elements for each owned storage. All spans have the same size
+     * and refer to the same entities in the same order. The _constness_ of the
+     * elements is as requested. Column storages offer a tuple of spans instead,
+     * one for each data member.<br/>
+     * Chunks contain at most `length` entities and never cross a page of the
+     * owned storage. Non-owned elements are not part of a chunk and are
+     * retrieved through the group as usual.
+     *
+     * @note
+     * Chunks are disjoint. Therefore, they can be safely processed by multiple
+     * threads at once.
+     *
+     * @param length The maximum number of entities per chunk.
+     * @return An iterable object to use to split the group in chunks.
+     */
+    [[nodiscard]] chunk_iterable chunks(const size_type length) const noexcept {
+        ENTT_ASSERT(length != 0u, "Invalid chunk size");
+
+        if(const auto len = size(); len != 0u) {
+            const auto cpools = pools_for(std::index_sequence_for<Owned...>{}, std::index_sequence_for<Get...>{});
+            const std::tuple<Owned *...> owned{std::get<Owned *>(cpools)...};
+            return chunk_iterable{{owned, 0u, len, length}, {owned, chunk_iterable::iterator::count(len, length), len, length}};
+        }
+
+        return chunk_iterable{};
+    }
+
+    /**
+     * @brief Checks whether a group can be sorted.
+     *
+     * Groups that share the ownership of their storage with more restrictive
+     * groups cannot be sorted, since sorting would break the nested ones.
+     *
+     * @return True if the group can be sorted, false otherwise.
+     */
+    [[nodiscard]] bool sortable() const noexcept {
+        return *this && (descriptor->inner == nullptr);
+    }
+
     /**
      * @brief Sort a group according to the given comparison function.
      *
@@ -1016,6 +1320,7 @@ public:
      */
     template<std::size_t... Index, typename Compare, typename Sort = std_sort, typename... Args>
     void sort(Compare compare, Sort algo = Sort{}, Args &&...args) const {
+        ENTT_ASSERT(sortable(), "Cannot sort nested groups");
         const auto cpools = pools_for(std::index_sequence_for<Owned...>{}, std::index_sequence_for<Get...>{});
 
         if constexpr(sizeof...(Index) == 0) {
@@ -1048,6 +1353,226 @@ private:
     handler *descriptor;
 };
 
+/**
+ * @brief Runtime group.
+ *
+ * Runtime groups are the type-erased counterpart of groups. They are created
+ * from lists of storage identifiers rather than types and are kept up to date
+ * through the signals of the underlying storage, exactly as their typed
+ * counterparts are.<br/>
+ * A runtime group returns all entities and only the entities that are at least
+ * in the _owned_ and _observed_ storage and not in the excluded ones. The
+ * entity list is tightly packed in memory, therefore no check is performed
+ * while iterating it.
+ *
+ * Owned storage are arranged so that the entities of the group are at the
+ * beginning of their packed arrays, as it happens with owning groups.
+ * Therefore, runtime groups and typed groups follow the same ownership rules.
+ *
+ * @b Important
+ *
+ * Iterators aren't invalidated if:
+ *
+ * * New elements are added to the storage.
+ * * The entity currently pointed is modified (for example, elements are added
+ *   or removed from it).
+ * * The entity currently pointed is destroyed.
+ *
+ * In all other cases, modifying the pools iterated by the group in any way
+ * invalidates all the iterators.
+ *
+ * @tparam Type Common base type.
+ */
+template<typename Type>
+class basic_runtime_group {
+    using base_type = std::remove_const_t<Type>;
+
+public:
+    /*! @brief Underlying entity identifier. */
+    using entity_type = base_type::entity_type;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Signed integer type. */
+    using difference_type = std::ptrdiff_t;
+    /*! @brief Common type among all storage types. */
+    using common_type = base_type;
+    /*! @brief Random access iterator type. */
+    using iterator = common_type::iterator;
+    /*! @brief Reverse iterator type. */
+    using reverse_iterator = common_type::reverse_iterator;
+    /*! @brief Group handler type. */
+    using handler = internal::runtime_group_handler<common_type>;
+
+    /*! @brief Default constructor to use to create empty, invalid groups. */
+    basic_runtime_group() noexcept
+        : descriptor{} {}
+
+    /**
+     * @brief Constructs a group from a group handler.
+     * @param ref A reference to a group handler.
+     */
+    basic_runtime_group(handler &ref) noexcept
+        : descriptor{&ref} {}
+
+    /**
+     * @brief Returns the leading storage of a group.
+     * @return The leading storage of the group.
+     */
+    [[nodiscard]] const common_type &handle() const noexcept {
+        return descriptor->handle();
+    }
+
+    /**
+     * @brief Returns the storage for a given index, if any.
+     *
+     * Owned storage come first, followed by the observed and the excluded
+     * ones, in the order in which they were provided.
+     *
+     * @param pos Index of the storage to return.
+     * @return The storage for the given index.
+     */
+    [[nodiscard]] Type *storage(const size_type pos) const noexcept {
+        return (*this && (pos < descriptor->count())) ? descriptor->storage(pos) : nullptr;
+    }
+
+    /**
+     * @brief Returns the number of entities that that are part of the group.
+     * @return Number of entities that that are part of the group.
+     */
+    [[nodiscard]] size_type size() const noexcept {
+        return *this ? descriptor->length() : size_type{};
+    }
+
+    /**
+     * @brief Checks whether a group is empty.
+     * @return True if the group is empty, false otherwise.
+     */
+    [[nodiscard]] bool empty() const noexcept {
+        return !*this || !descriptor->length();
+    }
+
+    /**
+     * @brief Returns an iterator to the first entity of the group.
+     *
+     * If the group is empty, the returned iterator will be equal to `end()`.
+     *
+     * @return An iterator to the first entity of the group.
+     */
+    [[nodiscard]] iterator begin() const noexcept {
+        return *this ? (handle().end() - static_cast<difference_type>(descriptor->length())) : iterator{};
+    }
+
+    /**
+     * @brief Returns an iterator that is past the last entity of the group.
+     * @return An iterator to the entity following the last entity of the
+     * group.
+     */
+    [[nodiscard]] iterator end() const noexcept {
+        return *this ? handle().end() : iterator{};
+    }
+
+    /**
+     * @brief Returns an iterator to the first entity of the reversed group.
+     *
+     * If the group is empty, the returned iterator will be equal to `rend()`.
+     *
+     * @return An iterator to the first entity of the reversed group.
+     */
+    [[nodiscard]] reverse_iterator rbegin() const noexcept {
+        return *this ? handle().rbegin() : reverse_iterator{};
+    }
+
+    /**
+     * @brief Returns an iterator that is past the last entity of the reversed
+     * group.
+     * @return An iterator to the entity following the last entity of the
+     * reversed group.
+     */
+    [[nodiscard]] reverse_iterator rend() const noexcept {
+        return *this ? (handle().rbegin() + static_cast<difference_type>(descriptor->length())) : reverse_iterator{};
+    }
+
+    /**
+     * @brief Returns the first entity of the group, if any.
+     * @return The first entity of the group if one exists, the null entity
+     * otherwise.
+     */
+    [[nodiscard]] entity_type front() const noexcept {
+        const auto it = begin();
+        return it != end() ? *it : null;
+    }
+
+    /**
+     * @brief Returns the last entity of the group, if any.
+     * @return The last entity of the group if one exists, the null entity
+     * otherwise.
+     */
+    [[nodiscard]] entity_type back() const noexcept {
+        const auto it = rbegin();
+        return it != rend() ? *it : null;
+    }
+
+    /**
+     * @brief Finds an entity.
+     * @param entt A valid identifier.
+     * @return An iterator to the given entity if it's found, past the end
+     * iterator otherwise.
+     */
+    [[nodiscard]] iterator find(const entity_type entt) const noexcept {
+        return contains(entt) ? handle().find(entt) : end();
+    }
+
+    /**
+     * @brief Returns the identifier that occupies the given position.
+     * @param pos Position of the element to return.
+     * @return The identifier that occupies the given position.
+     */
+    [[nodiscard]] entity_type operator[](const size_type pos) const {
+        return begin()[static_cast<difference_type>(pos)];
+    }
+
+    /**
+     * @brief Checks if a group is properly initialized.
+     * @return True if the group is properly initialized, false otherwise.
+     */
+    [[nodiscard]] explicit operator bool() const noexcept {
+        return descriptor != nullptr;
+    }
+
+    /**
+     * @brief Checks if a group contains an entity.
+     * @param entt A valid identifier.
+     * @return True if the group contains the given entity, false otherwise.
+     */
+    [[nodiscard]] bool contains(const entity_type entt) const noexcept {
+        return *this && handle().contains(entt) && (handle().index(entt) < (descriptor->length()));
+    }
+
+    /**
+     * @brief Iterates entities and applies the given function object to them.
+     *
+     * The function object is invoked for each entity. It is provided only with
+     * the entity itself.<br/>
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const entity_type);
+     * @endcode
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each(Func func) const {
+        for(const auto entity: *this) {
+            func(entity);
+        }
+    }
+
+private:
+    handler *descriptor;
+};
+
 } // namespace entt
 
 #endif
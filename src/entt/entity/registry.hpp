@@ -9,6 +9,7 @@
 #include <functional>
 #include <iterator>
 #include <memory>
+#include <span>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -217,7 +218,10 @@ class basic_registry {
     static_assert(std::is_same_v<typename alloc_traits::value_type, Entity>, "Invalid value type");
     // std::shared_ptr because of its type erased allocator which is useful here
     using pool_container_type = dense_map<id_type, std::shared_ptr<base_type>, stl::identity, std::equal_to<>, typename alloc_traits::template rebind_alloc<std::pair<const id_type, std::shared_ptr<base_type>>>>;
-    using group_container_type = dense_map<id_type, std::shared_ptr<internal::group_descriptor>, stl::identity, std::equal_to<>, typename alloc_traits::template rebind_alloc<std::pair<const id_type, std::shared_ptr<internal::group_descriptor>>>>;
+    using group_container_type = dense_map<id_type, std::shared_ptr<internal::group_descriptor<base_type>>, stl::identity, std::equal_to<>, typename alloc_traits::template rebind_alloc<std::pair<const id_type, std::shared_ptr<internal::group_descriptor<base_type>>>>>;
+    using nested_handler_type = internal::nested_group_descriptor<base_type>;
+    using runtime_handler_type = internal::runtime_group_handler<base_type>;
+    using hook_container_type = dense_map<id_type, typename runtime_handler_type::hook_type, stl::identity, std::equal_to<>, typename alloc_traits::template rebind_alloc<std::pair<const id_type, typename runtime_handler_type::hook_type>>>;
     using traits_type = entt_traits<Entity>;
 
     template<cvref_unqualified Type>
@@ -237,6 +241,10 @@ class basic_registry {
             pools.emplace(id, cpool);
             cpool->bind(*this);
 
+            if constexpr(requires(storage_type &elem) { elem.on_construct(); elem.on_destroy(); }) {
+                hooks.insert_or_assign(id, &runtime_handler_type::template connect<storage_type>);
+            }
+
             return static_cast<storage_type &>(*cpool);
         }
     }
@@ -256,6 +264,58 @@ class basic_registry {
         }
     }
 
+    [[nodiscard]] static id_type runtime_group_id(std::span<const id_type> owned, std::span<const id_type> get, std::span<const id_type> exclude) {
+        auto seed = type_hash<runtime_handler_type>::value();
+        std::vector<id_type> sorted{};
+
+        for(auto list: {owned, get, exclude}) {
+            // lists are sets, the same storage in a different order is the same group
+            sorted.assign(list.begin(), list.end());
+            std::sort(sorted.begin(), sorted.end());
+            seed ^= static_cast<id_type>(list.size()) + id_type{0x9e3779b9u} + static_cast<id_type>(seed << 6u) + static_cast<id_type>(seed >> 2u);
+
+            for(auto id: sorted) {
+                seed ^= id + id_type{0x9e3779b9u} + static_cast<id_type>(seed << 6u) + static_cast<id_type>(seed >> 2u);
+            }
+        }
+
+        return seed;
+    }
+
+    void nest(nested_handler_type &elem) {
+        nested_handler_type *curr{};
+        [[maybe_unused]] size_type count{};
+
+        for(auto &&data: groups) {
+            // only groups that own storage can overlap with each other
+            if(elem.overlaps(*data.second)) {
+                curr = static_cast<nested_handler_type *>(data.second.get());
+                ++count;
+            }
+        }
+
+        if(curr) {
+            nested_handler_type *next{};
+
+            for(; curr->inner; curr = curr->inner) {}
+            for(; curr && !curr->nested(elem); next = curr, curr = curr->outer) {}
+
+            ENTT_ASSERT(next == nullptr || elem.nested(*next), "Conflicting groups");
+
+            if((elem.outer = curr) != nullptr) {
+                curr->inner = &elem;
+            }
+
+            if((elem.inner = next) != nullptr) {
+                next->outer = &elem;
+            }
+
+            for(curr = elem.outer; curr; curr = curr->outer, --count) {}
+            for(curr = elem.inner; curr; curr = curr->inner, --count) {}
+            ENTT_ASSERT(count == 0u, "Conflicting groups");
+        }
+    }
+
     void rebind() {
         entities.bind(*this);
 
@@ -275,6 +335,10 @@ public:
     using size_type = std::size_t;
     /*! @brief Common type among all storage types. */
     using common_type = base_type;
+    /*! @brief Runtime group type. */
+    using runtime_group_type = basic_runtime_group<common_type>;
+    /*! @brief Constant runtime group type. */
+    using const_runtime_group_type = basic_runtime_group<const common_type>;
     /*! @brief Context type. */
     using context = internal::registry_context<allocator_type>;
     /*! @brief Iterable registry type. */
@@ -309,6 +373,7 @@ public:
         : vars{allocator},
           pools{allocator},
           groups{allocator},
+          hooks{allocator},
           entities{allocator} {
         pools.reserve(count);
         rebind();
@@ -325,6 +390,7 @@ public:
         : vars{std::move(other.vars)},
           pools{std::move(other.pools)},
           groups{std::move(other.groups)},
+          hooks{std::move(other.hooks)},
           entities{std::move(other.entities)} {
         rebind();
     }
@@ -358,6 +424,7 @@ public:
         swap(vars, other.vars);
         swap(pools, other.pools);
         swap(groups, other.groups);
+        swap(hooks, other.hooks);
         swap(entities, other.entities);
 
         rebind();
@@ -437,6 +504,7 @@ public:
      */
     bool reset(const id_type id) {
         ENTT_ASSERT(id != type_hash<entity_type>::value(), "Cannot reset entity storage");
+        hooks.erase(id);
         return !(pools.erase(id) == 0u);
     }
 
@@ -791,6 +859,34 @@ public:
         }
     }
 
+    /**
+     * @brief Preallocates memory for a given number of entities.
+     *
+     * The entity storage, all existing pools and all non-owning groups reserve
+     * enough room for `cap` entities, sparse pages included. As long as
+     * identifiers stay below the given capacity, creating entities and
+     * assigning elements doesn't allocate afterwards.
+     *
+     * @warning
+     * Pools and groups created after this call aren't affected. Make sure to
+     * create them upfront if needed.
+     *
+     * @param cap Desired capacity.
+     */
+    void reserve(const size_type cap) {
+        entities.reserve(cap);
+        entities.reserve_extent(cap);
+
+        for(auto &&curr: pools) {
+            curr.second->reserve(cap);
+            curr.second->reserve_extent(cap);
+        }
+
+        for(auto &&curr: groups) {
+            curr.second->reserve(cap);
+        }
+    }
+
     /**
      * @brief Removes all tombstones from a registry or only the pools for the
      * given elements.
@@ -851,7 +947,7 @@ public:
         if constexpr(sizeof...(Type) == 1u) {
             return (assure<std::remove_const_t<Type>>()->get(entt), ...);
         } else {
-            return std::forward_as_tuple(get<Type>(entt)...);
+            return std::tuple<decltype(get<Type>(entt))...>{get<Type>(entt)...};
         }
     }
 
@@ -861,7 +957,7 @@ public:
         if constexpr(sizeof...(Type) == 1u) {
             return (static_cast<storage_for_type<Type> &>(assure<std::remove_const_t<Type>>()).get(entt), ...);
         } else {
-            return std::forward_as_tuple(get<Type>(entt)...);
+            return std::tuple<decltype(get<Type>(entt))...>{get<Type>(entt)...};
         }
     }
 
@@ -1061,7 +1157,7 @@ public:
             handler = std::allocate_shared<handler_type>(get_allocator(), get_allocator(), std::forward_as_tuple(assure<std::remove_const_t<Get>>()...), std::forward_as_tuple(assure<std::remove_const_t<Exclude>>()...));
         } else {
             handler = std::allocate_shared<handler_type>(get_allocator(), std::forward_as_tuple(assure<std::remove_const_t<Owned>>()..., assure<std::remove_const_t<Get>>()...), std::forward_as_tuple(assure<std::remove_const_t<Exclude>>()...));
-            ENTT_ASSERT(std::all_of(groups.cbegin(), groups.cend(), [](const auto &data) { return !(data.second->owned(type_id<Owned>().hash()) || ...); }), "Conflicting groups");
+            nest(*handler);
         }
 
         groups.emplace(group_type::group_id(), handler);
@@ -1082,6 +1178,68 @@ public:
         return {};
     }
 
+    /**
+     * @brief Returns a runtime group for the given storage.
+     *
+     * Storage are identified by the names used to map them within the
+     * registry. All of them must exist and offer construction and destruction
+     * signals when the group is created.<br/>
+     * Requesting twice a group for the same lists of storage returns the same
+     * group, no matter the order of the names in the lists. Storage are then
+     * returned by the group in the order of the first request.
+     *
+     * @param owned Names of the storage _owned_ by the group, if any.
+     * @param get Names of the storage _observed_ by the group, if any.
+     * @param exclude Names of the storage used to filter the group, if any.
+     * @return A newly created runtime group.
+     */
+    runtime_group_type runtime_group(std::span<const id_type> owned, std::span<const id_type> get = {}, std::span<const id_type> exclude = {}) {
+        const auto id = runtime_group_id(owned, get, exclude);
+
+        if(auto it = groups.find(id); it != groups.cend()) {
+            return {*std::static_pointer_cast<runtime_handler_type>(it->second)};
+        }
+
+        typename runtime_handler_type::container_type ogpool{get_allocator()};
+        typename runtime_handler_type::container_type epool{get_allocator()};
+
+        auto collect = [this](auto &elem, std::span<const id_type> list) {
+            for(auto curr: list) {
+                ENTT_ASSERT(pools.contains(curr) && hooks.contains(curr), "Invalid storage");
+                elem.push_back(pools[curr].get());
+            }
+        };
+
+        collect(ogpool, owned);
+        collect(ogpool, get);
+        collect(epool, exclude);
+
+        auto handler = std::allocate_shared<runtime_handler_type>(get_allocator(), get_allocator(), owned.size(), std::move(ogpool), std::move(epool));
+        nest(*handler);
+
+        auto connect = [this, &handler, pos = size_type{}](std::span<const id_type> list, const bool excluded) mutable {
+            for(auto curr: list) {
+                hooks[curr](*handler->storage(pos++), *handler, excluded);
+            }
+        };
+
+        connect(owned, false);
+        connect(get, false);
+        connect(exclude, true);
+
+        groups.emplace(id, handler);
+        return {*handler};
+    }
+
+    /*! @copydoc runtime_group */
+    [[nodiscard]] const_runtime_group_type runtime_group_if_exists(std::span<const id_type> owned, std::span<const id_type> get = {}, std::span<const id_type> exclude = {}) const {
+        if(auto it = groups.find(runtime_group_id(owned, get, exclude)); it != groups.cend()) {
+            return {*std::static_pointer_cast<runtime_handler_type>(it->second)};
+        }
+
+        return {};
+    }
+
     /**
      * @brief Checks whether the given elements belong to any group.
      * @tparam Type Types of elements in which one is interested.
@@ -1090,7 +1248,7 @@ public:
      */
     template<typename... Type>
     [[nodiscard]] bool owned() const {
-        return std::any_of(groups.cbegin(), groups.cend(), [](auto &&data) { return (data.second->owned(type_id<Type>().hash()) || ...); });
+        return std::any_of(groups.cbegin(), groups.cend(), [this](auto &&data) { return (data.second->owned(assure<std::remove_const_t<Type>>()) || ...); });
     }
 
     /**
@@ -1159,6 +1317,65 @@ public:
         assure<To>().sort_as(cpool.begin(), cpool.end());
     }
 
+    /**
+     * @brief Sorts the elements of a given element in parallel.
+     *
+     * Elements are rearranged by means of the given executor once sorted. The
+     * sort function object is parallel only if it supports it, as it happens
+     * for example with `parallel_sort`:
+     *
+     * @code{.cpp}
+     * registry.par_sort<position>(jobs, compare, entt::parallel_sort{}, jobs);
+     * @endcode
+     *
+     * @sa sort
+     *
+     * @warning
+     * Pools of elements owned by a group cannot be sorted.
+     *
+     * @tparam Type Type of elements to sort.
+     * @tparam Executor Type of executor.
+     * @tparam Compare Type of comparison function object.
+     * @tparam Sort Type of sort function object.
+     * @tparam Args Types of arguments to forward to the sort function object.
+     * @param jobs The executor to use to rearrange the elements.
+     * @param compare A valid comparison function object.
+     * @param algo A valid sort function object.
+     * @param args Arguments to forward to the sort function object, if any.
+     */
+    template<typename Type, typename Executor, typename Compare, typename Sort = std_sort, typename... Args>
+    void par_sort(Executor &jobs, Compare compare, Sort algo = Sort{}, Args &&...args) {
+        ENTT_ASSERT(!owned<Type>(), "Cannot sort owned storage");
+        auto &cpool = assure<Type>();
+
+        if constexpr(std::is_invocable_v<Compare, decltype(cpool.get({})), decltype(cpool.get({}))>) {
+            auto comp = [&cpool, compare = std::move(compare)](const auto lhs, const auto rhs) { return compare(std::as_const(cpool.get(lhs)), std::as_const(cpool.get(rhs))); };
+            cpool.par_sort(jobs, std::move(comp), std::move(algo), std::forward<Args>(args)...);
+        } else {
+            cpool.par_sort(jobs, std::move(compare), std::move(algo), std::forward<Args>(args)...);
+        }
+    }
+
+    /**
+     * @brief Sorts two pools of elements in the same way, in parallel.
+     *
+     * @sa sort
+     *
+     * @warning
+     * Pools of elements owned by a group cannot be sorted.
+     *
+     * @tparam To Type of elements to sort.
+     * @tparam From Type of elements to use to sort.
+     * @tparam Executor Type of executor.
+     * @param jobs The executor to use to rearrange the elements.
+     */
+    template<typename To, typename From, typename Executor>
+    void par_sort(Executor &jobs) {
+        ENTT_ASSERT(!owned<To>(), "Cannot sort owned storage");
+        const base_type &cpool = assure<From>();
+        assure<To>().par_sort_as(jobs, cpool.begin(), cpool.end());
+    }
+
     /**
      * @brief Returns the context object, that is, a general purpose container.
      * @return The context object, that is, a general purpose container.
@@ -1176,6 +1393,7 @@ private:
     context vars;
     pool_container_type pools;
     group_container_type groups;
+    hook_container_type hooks;
     storage_for_type<entity_type> entities;
 };
 
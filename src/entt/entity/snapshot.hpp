@@ -157,6 +157,35 @@ public:
         return *this;
     }
 
+    /**
+     * @brief Serializes all elements of the given types in parallel.
+     *
+     * Each storage is serialized to its own archive on a different job, as if
+     * by invoking `get` with the same archive. Archives are therefore
+     * independent and can be stitched together in any order, as long as the
+     * loader restores them with the same archive-to-type association.
+     *
+     * @warning
+     * Archives are used concurrently and must not share state unless it is
+     * properly synchronized.
+     *
+     * @tparam Type Types of elements to serialize.
+     * @tparam Executor Type of executor to use to run jobs.
+     * @param jobs A valid executor.
+     * @param archive An iterator to the archive to use for the first type.
+     * @return An object of this type to continue creating the snapshot.
+     */
+    template<typename... Type, typename Executor>
+    const basic_snapshot &par_get(Executor &jobs, stl::random_access_iterator auto archive) const {
+        jobs.parallel_for(sizeof...(Type), [this, archive](const std::size_t pos) {
+            [this, pos, archive]<std::size_t... Index>(std::index_sequence<Index...>) {
+                ((pos == Index ? (get<Type>(archive[Index]), void()) : void()), ...);
+            }(std::index_sequence_for<Type...>{});
+        });
+
+        return *this;
+    }
+
 private:
     const registry_type *reg;
 };
@@ -176,6 +205,32 @@ class basic_snapshot_loader {
     static_assert(!std::is_const_v<Registry>, "Non-const registry type required");
     using traits_type = entt_traits<typename Registry::entity_type>;
 
+    template<typename Type, typename Archive>
+    void restore(Archive &archive, auto &storage, [[maybe_unused]] const bool shared) {
+        auto &other = reg->template storage<entity_type>();
+        typename traits_type::entity_type length{};
+        entity_type entt{null};
+
+        archive(length);
+
+        while(length--) {
+            if(archive(entt); entt != null) {
+                // concurrent jobs cannot generate entities, they must be restored upfront
+                ENTT_ASSERT(!shared || other.contains(entt), "Entity not available for use");
+                const auto entity = other.contains(entt) ? entt : other.generate(entt);
+                ENTT_ASSERT(entity == entt, "Entity not available for use");
+
+                if constexpr(std::tuple_size_v<decltype(storage.get_as_tuple({}))> == 0u) {
+                    storage.emplace(entity);
+                } else {
+                    Type elem{};
+                    archive(elem);
+                    storage.emplace(entity, std::move(elem));
+                }
+            }
+        }
+    }
+
 public:
     /*! Basic registry type. */
     using registry_type = Registry;
@@ -224,14 +279,13 @@ public:
     template<typename Type, typename Archive>
     basic_snapshot_loader &get(Archive &archive, const id_type id = type_hash<Type>::value()) {
         auto &storage = reg->template storage<Type>(id);
-        typename traits_type::entity_type length{};
-
-        archive(length);
 
         if constexpr(std::is_same_v<Type, entity_type>) {
+            typename traits_type::entity_type length{};
             typename traits_type::entity_type count{};
             entity_type placeholder{};
 
+            archive(length);
             storage.reserve(length);
             archive(count);
 
@@ -244,24 +298,40 @@ public:
             storage.start_from(traits_type::next(placeholder));
             storage.free_list(count);
         } else {
-            auto &other = reg->template storage<entity_type>();
-            entity_type entt{null};
+            restore<Type>(archive, storage, false);
+        }
 
-            while(length--) {
-                if(archive(entt); entt != null) {
-                    const auto entity = other.contains(entt) ? entt : other.generate(entt);
-                    ENTT_ASSERT(entity == entt, "Entity not available for use");
+        return *this;
+    }
 
-                    if constexpr(std::tuple_size_v<decltype(storage.get_as_tuple({}))> == 0u) {
-                        storage.emplace(entity);
-                    } else {
-                        Type elem{};
-                        archive(elem);
-                        storage.emplace(entity, std::move(elem));
-                    }
-                }
-            }
-        }
+    /**
+     * @brief Restores all elements of the given types in parallel.
+     *
+     * Each storage is restored from its own archive on a different job, as if
+     * by invoking `get` with the same archive.<br/>
+     * Storages are created upfront on the calling thread, while the entities
+     * must be restored already by means of a previous call to `get`.
+     *
+     * @warning
+     * Types must be unique and listeners attached to the storages are invoked
+     * concurrently.
+     *
+     * @tparam Type Types of elements to restore.
+     * @tparam Executor Type of executor to use to run jobs.
+     * @param jobs A valid executor.
+     * @param archive An iterator to the archive to use for the first type.
+     * @return A valid loader to continue restoring data.
+     */
+    template<typename... Type, typename Executor>
+    basic_snapshot_loader &par_get(Executor &jobs, stl::random_access_iterator auto archive) {
+        static_assert((!std::is_same_v<Type, entity_type> && ...), "Entity types not supported");
+        std::tuple<decltype(reg->template storage<Type>())...> storage{reg->template storage<Type>()...};
+
+        jobs.parallel_for(sizeof...(Type), [this, &storage, archive](const std::size_t pos) {
+            [this, &storage, pos, archive]<std::size_t... Index>(std::index_sequence<Index...>) {
+                ((pos == Index ? restore<Type>(archive[Index], std::get<Index>(storage), true) : void()), ...);
+            }(std::index_sequence_for<Type...>{});
+        });
 
         return *this;
     }
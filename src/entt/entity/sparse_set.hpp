@@ -1,6 +1,7 @@
 #ifndef ENTT_ENTITY_SPARSE_SET_HPP
 #define ENTT_ENTITY_SPARSE_SET_HPP
 
+#include <algorithm>
 #include <compare>
 #include <concepts>
 #include <cstddef>
@@ -213,6 +214,42 @@ class basic_sparse_set {
         std::swap(from, to);
     }
 
+    void swap_all(std::size_t *from, const std::size_t length) {
+        for(std::size_t pos{}; pos < length; ++pos) {
+            auto curr = pos;
+
+            while(from[curr] != pos) {
+                const auto next = std::exchange(from[curr], curr);
+                swap_or_move(next, curr);
+                curr = next;
+            }
+
+            from[curr] = curr;
+        }
+    }
+
+    template<typename Executor, typename Func>
+    void arrange(Executor &jobs, const std::size_t length, Func func) {
+        constexpr std::size_t page_size = ENTT_PACKED_PAGE;
+        const auto chunks = (length + page_size - 1u) / page_size;
+        std::vector<std::size_t, typename alloc_traits::template rebind_alloc<std::size_t>> from(length, packed.get_allocator());
+
+        // the packed array is already in its final order, the sparse array still refers to the previous one
+        jobs.parallel_for(chunks, [this, &from, length](const std::size_t chunk) {
+            for(auto pos = chunk * page_size, last = (std::min)(pos + page_size, length); pos < last; ++pos) {
+                from[pos] = index(packed[pos]);
+            }
+        });
+
+        func(from.data(), length);
+
+        jobs.parallel_for(chunks, [this, length](const std::size_t chunk) {
+            for(auto pos = chunk * page_size, last = (std::min)(pos + page_size, length); pos < last; ++pos) {
+                sparse_ref(packed[pos]) = traits_type::combine(static_cast<traits_type::entity_type>(pos), traits_type::to_integral(packed[pos]));
+            }
+        });
+    }
+
 private:
     [[nodiscard]] virtual const void *get_at(const std::size_t) const {
         return nullptr;
@@ -354,6 +391,81 @@ protected:
     // NOLINTNEXTLINE(performance-unnecessary-value-param)
     virtual void bind_any(any) noexcept {}
 
+    /**
+     * @brief Sorts the first elements of a sparse set in parallel.
+     *
+     * The function object is invoked as `func(from, length)` once the packed
+     * array is sorted. Position `pos` of the packed array refers to the element
+     * that was at position `from[pos]` before sorting.
+     *
+     * @tparam Executor Type of executor.
+     * @tparam Func Type of function object to invoke to move elements.
+     * @tparam Compare Type of comparison function object.
+     * @tparam Sort Type of sort function object.
+     * @tparam Args Types of arguments to forward to the sort function object.
+     * @param jobs The executor to use to apply the permutation.
+     * @param func A valid function object.
+     * @param length Number of elements to sort.
+     * @param compare A valid comparison function object.
+     * @param algo A valid sort function object.
+     * @param args Arguments to forward to the sort function object, if any.
+     */
+    template<typename Executor, typename Func, typename Compare, typename Sort, typename... Args>
+    void arrange_n(Executor &jobs, Func func, const std::size_t length, Compare compare, Sort algo, Args &&...args) {
+        ENTT_ASSERT((mode != deletion_policy::in_place) || (head == max_size), "Sorting with tombstones not allowed");
+        ENTT_ASSERT(!(length > packed.size()), "Length exceeds the number of elements");
+
+        algo(packed.rend() - static_cast<std::ptrdiff_t>(length), packed.rend(), std::move(compare), std::forward<Args>(args)...);
+        arrange(jobs, length, std::move(func));
+    }
+
+    /**
+     * @brief Sorts entities according to their order in a range, in parallel.
+     *
+     * The function object is invoked as `func(from, length)` once the packed
+     * array is sorted. Position `pos` of the packed array refers to the element
+     * that was at position `from[pos]` before sorting.
+     *
+     * @tparam Executor Type of executor.
+     * @tparam Func Type of function object to invoke to move elements.
+     * @tparam It Type of input iterator.
+     * @param jobs The executor to use to apply the permutation.
+     * @param func A valid function object.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @return An iterator past the last of the elements actually shared.
+     */
+    template<typename Executor, typename Func, stl::input_iterator It>
+    basic_iterator arrange_as(Executor &jobs, Func func, It first, It last) {
+        ENTT_ASSERT((mode != deletion_policy::in_place) || (head == max_size), "Sorting with tombstones not allowed");
+        const std::size_t len = (mode == deletion_policy::swap_only) ? head : packed.size();
+        std::vector<bool, typename alloc_traits::template rebind_alloc<bool>> shared(len, false, packed.get_allocator());
+        packed_container_type other{packed.get_allocator()};
+
+        for(; (other.size() != len) && (first != last); ++first) {
+            if(const auto curr = *first; contains(curr) && (index(curr) < len)) {
+                shared[index(curr)] = true;
+                other.push_back(curr);
+            }
+        }
+
+        std::size_t pos{};
+
+        for(std::size_t next{}; next < len; ++next) {
+            if(!shared[next]) {
+                packed[pos++] = packed[next];
+            }
+        }
+
+        // shared entities are iterated first and in the same order they have in the range
+        for(auto it = other.crbegin(), to = other.crend(); it != to; ++it) {
+            packed[pos++] = *it;
+        }
+
+        arrange(jobs, len, std::move(func));
+        return basic_iterator{packed, static_cast<std::ptrdiff_t>(len - other.size())};
+    }
+
 public:
     /*! @brief Allocator type. */
     using allocator_type = Allocator;
@@ -519,6 +631,26 @@ public:
         packed.reserve(cap);
     }
 
+    /**
+     * @brief Allocates all the sparse pages required by a given extent.
+     *
+     * Pages are created on demand otherwise. Once allocated upfront, inserting
+     * entities with an identifier below the given extent doesn't allocate
+     * sparse pages anymore.
+     *
+     * @param len Desired extent.
+     */
+    void reserve_extent(const size_type len) {
+        if(len != 0u) {
+            const auto last = pos_to_page(len - 1u) + 1u;
+            sparse.reserve(last);
+
+            for(size_type page{}; page < last; ++page) {
+                static_cast<void>(assure_at_least(traits_type::construct(static_cast<traits_type::entity_type>(page * traits_type::page_size), 0u)));
+            }
+        }
+    }
+
     /**
      * @brief Returns the number of elements that a sparse set has currently
      * allocated space for.
@@ -696,6 +828,20 @@ public:
         return elem && (((mask & traits_type::to_integral(entt)) ^ traits_type::to_integral(*elem)) < cap);
     }
 
+    /**
+     * @brief Prefetches the data used to look up an entity.
+     *
+     * This is only a hint. The sparse set is left untouched and nothing
+     * happens if the entity cannot belong to the sparse set.
+     *
+     * @param entt A valid identifier.
+     */
+    void prefetch(const entity_type entt) const noexcept {
+        if(const auto *elem = sparse_ptr(entt); elem) {
+            ENTT_PREFETCH(elem);
+        }
+    }
+
     /**
      * @brief Returns the contained version for an identifier.
      * @param entt A valid identifier.
@@ -1037,6 +1183,69 @@ public:
         return it;
     }
 
+    /**
+     * @brief Sort the first count elements according to the given comparison
+     * function, in parallel.
+     *
+     * The sort function object is used as-is and is parallel only if it
+     * supports it (see `parallel_sort`). Instead, the permutation is always
+     * applied to the sparse array in parallel by means of the given executor.
+     *
+     * @sa sort_n
+     *
+     * @tparam Executor Type of executor.
+     * @tparam Compare Type of comparison function object.
+     * @tparam Sort Type of sort function object.
+     * @tparam Args Types of arguments to forward to the sort function object.
+     * @param jobs The executor to use to apply the permutation.
+     * @param length Number of elements to sort.
+     * @param compare A valid comparison function object.
+     * @param algo A valid sort function object.
+     * @param args Arguments to forward to the sort function object, if any.
+     */
+    template<typename Executor, typename Compare, typename Sort = std_sort, typename... Args>
+    void par_sort_n(Executor &jobs, const size_type length, Compare compare, Sort algo = Sort{}, Args &&...args) {
+        arrange_n(jobs, [this](size_type *from, const size_type len) { swap_all(from, len); }, length, std::move(compare), std::move(algo), std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Sort all elements according to the given comparison function, in
+     * parallel.
+     *
+     * @sa par_sort_n
+     *
+     * @tparam Executor Type of executor.
+     * @tparam Compare Type of comparison function object.
+     * @tparam Sort Type of sort function object.
+     * @tparam Args Types of arguments to forward to the sort function object.
+     * @param jobs The executor to use to apply the permutation.
+     * @param compare A valid comparison function object.
+     * @param algo A valid sort function object.
+     * @param args Arguments to forward to the sort function object, if any.
+     */
+    template<typename Executor, typename Compare, typename Sort = std_sort, typename... Args>
+    void par_sort(Executor &jobs, Compare compare, Sort algo = Sort{}, Args &&...args) {
+        const size_type len = (mode == deletion_policy::swap_only) ? head : packed.size();
+        par_sort_n(jobs, len, std::move(compare), std::move(algo), std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Sort entities according to their order in a range, in parallel.
+     *
+     * @sa sort_as
+     *
+     * @tparam Executor Type of executor.
+     * @tparam It Type of input iterator.
+     * @param jobs The executor to use to apply the permutation.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @return An iterator past the last of the elements actually shared.
+     */
+    template<typename Executor, stl::input_iterator It>
+    iterator par_sort_as(Executor &jobs, It first, It last) {
+        return arrange_as(jobs, [this](size_type *from, const size_type len) { swap_all(from, len); }, std::move(first), std::move(last));
+    }
+
     /*! @brief Clears a sparse set. */
     void clear() {
         pop_all();
@@ -1,20 +1,28 @@
 #ifndef ENTT_ENTITY_STORAGE_HPP
 #define ENTT_ENTITY_STORAGE_HPP
 
+#include <algorithm>
+#include <bit>
 #include <compare>
 #include <concepts>
 #include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <iterator>
 #include <memory>
+#include <span>
 #include <tuple>
 #include <type_traits>
 #include <utility>
 #include <vector>
 #include "../config/config.h"
+#include "../container/bitset.hpp"
+#include "../core/algorithm.hpp"
 #include "../core/bit.hpp"
 #include "../core/iterator.hpp"
 #include "../core/memory.hpp"
 #include "../core/type_info.hpp"
+#include "../core/type_traits.hpp"
 #include "../stl/iterator.hpp"
 #include "../stl/memory.hpp"
 #include "component.hpp"
@@ -133,6 +141,111 @@ private:
     difference_type offset;
 };
 
+template<typename Container>
+class contiguous_storage_iterator final {
+    template<typename>
+    friend class contiguous_storage_iterator;
+
+    using container_type = std::remove_const_t<Container>;
+
+    using iterator_traits = std::iterator_traits<std::conditional_t<
+        std::is_const_v<Container>,
+        typename container_type::const_pointer,
+        typename container_type::pointer>>;
+
+public:
+    using value_type = iterator_traits::value_type;
+    using pointer = iterator_traits::pointer;
+    using reference = iterator_traits::reference;
+    using difference_type = iterator_traits::difference_type;
+    using iterator_category = std::random_access_iterator_tag;
+
+    constexpr contiguous_storage_iterator() noexcept = default;
+
+    constexpr contiguous_storage_iterator(Container *ref, const difference_type idx) noexcept
+        : payload{ref},
+          offset{idx} {}
+
+    template<std::same_as<std::remove_const_t<Container>> Other>
+    requires std::is_const_v<Container>
+    constexpr contiguous_storage_iterator(const contiguous_storage_iterator<Other> &other) noexcept
+        : contiguous_storage_iterator{other.payload, other.offset} {}
+
+    constexpr contiguous_storage_iterator &operator++() noexcept {
+        return --offset, *this;
+    }
+
+    constexpr contiguous_storage_iterator operator++(int) noexcept {
+        const contiguous_storage_iterator orig = *this;
+        return ++(*this), orig;
+    }
+
+    constexpr contiguous_storage_iterator &operator--() noexcept {
+        return ++offset, *this;
+    }
+
+    constexpr contiguous_storage_iterator operator--(int) noexcept {
+        const contiguous_storage_iterator orig = *this;
+        return operator--(), orig;
+    }
+
+    constexpr contiguous_storage_iterator &operator+=(const difference_type value) noexcept {
+        offset -= value;
+        return *this;
+    }
+
+    constexpr contiguous_storage_iterator operator+(const difference_type value) const noexcept {
+        contiguous_storage_iterator copy = *this;
+        return (copy += value);
+    }
+
+    constexpr contiguous_storage_iterator &operator-=(const difference_type value) noexcept {
+        return (*this += -value);
+    }
+
+    constexpr contiguous_storage_iterator operator-(const difference_type value) const noexcept {
+        return (*this + -value);
+    }
+
+    [[nodiscard]] constexpr reference operator[](const difference_type value) const noexcept {
+        // the array is indexed on every access, it can be reallocated during iterations
+        return (*payload)[static_cast<Container::size_type>(index() - value)];
+    }
+
+    [[nodiscard]] constexpr pointer operator->() const noexcept {
+        return std::addressof(operator[](0));
+    }
+
+    [[nodiscard]] constexpr reference operator*() const noexcept {
+        return operator[](0);
+    }
+
+    template<typename Other>
+    [[nodiscard]] constexpr std::ptrdiff_t operator-(const contiguous_storage_iterator<Other> &other) const noexcept {
+        // intentionally reversed due to backward iteration
+        return other.offset - offset;
+    }
+
+    template<typename Other>
+    [[nodiscard]] constexpr bool operator==(const contiguous_storage_iterator<Other> &other) const noexcept {
+        return offset == other.offset;
+    }
+
+    template<typename Other>
+    [[nodiscard]] constexpr auto operator<=>(const contiguous_storage_iterator<Other> &other) const noexcept {
+        // intentionally reversed due to backward iteration
+        return other.offset <=> offset;
+    }
+
+    [[nodiscard]] constexpr difference_type index() const noexcept {
+        return offset - 1;
+    }
+
+private:
+    Container *payload;
+    difference_type offset;
+};
+
 template<typename It, typename... Other>
 class extended_storage_iterator final {
     template<typename, typename...>
@@ -140,176 +253,2770 @@ class extended_storage_iterator final {
 
 public:
     using iterator_type = It;
-    using value_type = decltype(std::tuple_cat(std::make_tuple(*std::declval<It>()), std::forward_as_tuple(*std::declval<Other>()...)));
+    // proxy references are returned by value
+    using value_type = std::tuple<std::decay_t<decltype(*std::declval<It>())>, decltype(*std::declval<Other>())...>;
     using pointer = input_iterator_pointer<value_type>;
     using reference = value_type;
     using difference_type = std::ptrdiff_t;
     using iterator_category = std::input_iterator_tag;
     using iterator_concept = std::forward_iterator_tag;
 
-    constexpr extended_storage_iterator()
-        : it{} {}
+    constexpr extended_storage_iterator()
+        : it{} {}
+
+    constexpr extended_storage_iterator(iterator_type base, Other... other)
+        : it{base, other...} {}
+
+    template<typename... Args>
+    requires (!std::same_as<Other, Args> && ...) && (std::constructible_from<Other, Args> && ...)
+    constexpr extended_storage_iterator(const extended_storage_iterator<It, Args...> &other)
+        : it{other.it} {}
+
+    constexpr extended_storage_iterator &operator++() noexcept {
+        return ++std::get<It>(it), (++std::get<Other>(it), ...), *this;
+    }
+
+    constexpr extended_storage_iterator operator++(int) noexcept {
+        const extended_storage_iterator orig = *this;
+        return ++(*this), orig;
+    }
+
+    constexpr extended_storage_iterator &operator+=(const difference_type value) noexcept {
+        return std::get<It>(it) += value, ((std::get<Other>(it) += value), ...), *this;
+    }
+
+    [[nodiscard]] constexpr pointer operator->() const noexcept {
+        return operator*();
+    }
+
+    [[nodiscard]] constexpr reference operator*() const noexcept {
+        return {*std::get<It>(it), *std::get<Other>(it)...};
+    }
+
+    [[nodiscard]] constexpr iterator_type base() const noexcept {
+        return std::get<It>(it);
+    }
+
+    template<typename... Args>
+    [[nodiscard]] constexpr bool operator==(const extended_storage_iterator<Args...> &other) const noexcept {
+        return std::get<0>(it) == std::get<0>(other.it);
+    }
+
+private:
+    std::tuple<It, Other...> it;
+};
+
+template<typename Traits, typename Type>
+struct page_alignment_of: std::integral_constant<std::size_t, alignof(Type)> {};
+
+template<typename Traits, typename Type>
+requires std::is_convertible_v<decltype(Traits::page_alignment), std::size_t>
+struct page_alignment_of<Traits, Type>: std::integral_constant<std::size_t, (std::max)(std::size_t{Traits::page_alignment}, alignof(Type))> {};
+
+template<std::size_t Align>
+struct alignas(Align) page_block {
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, modernize-avoid-c-arrays)
+    std::byte data[Align];
+};
+
+template<typename Traits>
+concept bitset_tagged = (Traits::page_size == 0u) && Traits::bitset_tag;
+
+template<typename Traits>
+concept columnar = requires { typename Traits::columns; } && (Traits::page_size != 0u) && (Traits::page_size != no_pagination) && (Traits::columns::size != 0u);
+
+template<typename Type, auto... Member>
+class column_reference final {
+    template<typename, auto...>
+    friend class column_reference;
+
+    template<auto Candidate>
+    static constexpr std::size_t index = value_list_index_v<Candidate, value_list<Member...>>;
+
+public:
+    using element_type = std::remove_const_t<Type>;
+
+    constexpr column_reference(decltype(std::declval<Type &>().*Member)... elem) noexcept
+        : refs{elem...} {}
+
+    template<std::same_as<element_type> Other>
+    requires std::is_const_v<Type>
+    constexpr column_reference(const column_reference<Other, Member...> &other) noexcept
+        : refs{other.refs} {}
+
+    const column_reference &operator=(const element_type &value) const
+    requires (!std::is_const_v<Type>)
+    {
+        ((std::get<index<Member>>(refs) = value.*Member), ...);
+        return *this;
+    }
+
+    const column_reference &operator=(element_type &&value) const
+    requires (!std::is_const_v<Type>)
+    {
+        ((std::get<index<Member>>(refs) = std::move(value.*Member)), ...);
+        return *this;
+    }
+
+    template<auto Candidate>
+    [[nodiscard]] constexpr auto &get() const noexcept {
+        return std::get<index<Candidate>>(refs);
+    }
+
+    [[nodiscard]] operator element_type() const {
+        element_type elem{};
+        ((elem.*Member = std::get<index<Member>>(refs)), ...);
+        return elem;
+    }
+
+private:
+    std::tuple<decltype(std::declval<Type &>().*Member)...> refs;
+};
+
+template<typename Container, typename Reference, auto Page>
+class column_iterator final {
+    template<typename, typename, auto>
+    friend class column_iterator;
+
+public:
+    using value_type = Reference;
+    using pointer = input_iterator_pointer<value_type>;
+    using reference = value_type;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::input_iterator_tag;
+    using iterator_concept = std::random_access_iterator_tag;
+
+    constexpr column_iterator() noexcept = default;
+
+    constexpr column_iterator(Container *ref, const difference_type idx) noexcept
+        : payload{ref},
+          offset{idx} {}
+
+    template<std::same_as<std::remove_const_t<Container>> Other, typename Arg>
+    requires std::is_const_v<Container>
+    constexpr column_iterator(const column_iterator<Other, Arg, Page> &other) noexcept
+        : column_iterator{other.payload, other.offset} {}
+
+    constexpr column_iterator &operator++() noexcept {
+        return --offset, *this;
+    }
+
+    constexpr column_iterator operator++(int) noexcept {
+        const column_iterator orig = *this;
+        return ++(*this), orig;
+    }
+
+    constexpr column_iterator &operator--() noexcept {
+        return ++offset, *this;
+    }
+
+    constexpr column_iterator operator--(int) noexcept {
+        const column_iterator orig = *this;
+        return operator--(), orig;
+    }
+
+    constexpr column_iterator &operator+=(const difference_type value) noexcept {
+        offset -= value;
+        return *this;
+    }
+
+    constexpr column_iterator operator+(const difference_type value) const noexcept {
+        column_iterator copy = *this;
+        return (copy += value);
+    }
+
+    constexpr column_iterator &operator-=(const difference_type value) noexcept {
+        return (*this += -value);
+    }
+
+    constexpr column_iterator operator-(const difference_type value) const noexcept {
+        return (*this + -value);
+    }
+
+    [[nodiscard]] constexpr reference operator[](const difference_type value) const noexcept {
+        const auto pos = static_cast<std::size_t>(index() - value);
+        return std::apply([pos](auto &...pages) { return reference{pages[pos / Page][fast_mod(pos, Page)]...}; }, *payload);
+    }
+
+    [[nodiscard]] constexpr pointer operator->() const noexcept {
+        return operator*();
+    }
+
+    [[nodiscard]] constexpr reference operator*() const noexcept {
+        return operator[](0);
+    }
+
+    template<typename Other, typename Arg>
+    [[nodiscard]] constexpr std::ptrdiff_t operator-(const column_iterator<Other, Arg, Page> &other) const noexcept {
+        // intentionally reversed due to backward iteration
+        return other.offset - offset;
+    }
+
+    template<typename Other, typename Arg>
+    [[nodiscard]] constexpr bool operator==(const column_iterator<Other, Arg, Page> &other) const noexcept {
+        return offset == other.offset;
+    }
+
+    template<typename Other, typename Arg>
+    [[nodiscard]] constexpr auto operator<=>(const column_iterator<Other, Arg, Page> &other) const noexcept {
+        // intentionally reversed due to backward iteration
+        return other.offset <=> offset;
+    }
+
+    [[nodiscard]] constexpr difference_type index() const noexcept {
+        return offset - 1;
+    }
+
+private:
+    Container *payload;
+    difference_type offset;
+};
+
+struct any_member {
+    template<typename Type>
+    // NOLINTNEXTLINE(google-explicit-constructor)
+    operator Type() const;
+};
+
+template<typename Type, typename... Member>
+[[nodiscard]] consteval std::size_t aggregate_arity() noexcept {
+    if constexpr(requires { Type{Member{}..., any_member{}}; }) {
+        return aggregate_arity<Type, Member..., any_member>();
+    } else {
+        return sizeof...(Member);
+    }
+}
+
+template<typename, typename, typename>
+struct column_layout;
+
+template<typename Type, typename Allocator, auto... Member>
+struct column_layout<Type, Allocator, value_list<Member...>> {
+    template<auto Candidate>
+    using column_type = std::remove_reference_t<decltype(std::declval<Type &>().*Candidate)>;
+
+    template<auto Candidate>
+    using pointer = std::allocator_traits<Allocator>::template rebind_traits<column_type<Candidate>>::pointer;
+
+    using container_type = std::tuple<std::vector<pointer<Member>, typename std::allocator_traits<Allocator>::template rebind_alloc<pointer<Member>>>...>;
+    using reference = column_reference<Type, Member...>;
+    using const_reference = column_reference<const Type, Member...>;
+
+    static constexpr bool is_nothrow_movable = ((std::is_nothrow_move_constructible_v<column_type<Member>> && std::is_nothrow_move_assignable_v<column_type<Member>>) && ...);
+    static constexpr bool is_complete = !std::is_aggregate_v<Type> || (aggregate_arity<Type>() == sizeof...(Member));
+};
+
+struct blob_range {
+    std::size_t offset;
+    std::size_t length;
+};
+
+template<typename Arena, typename Ranges>
+class blob_iterator final {
+    template<typename, typename>
+    friend class blob_iterator;
+
+public:
+    using value_type = std::span<std::conditional_t<std::is_const_v<Arena>, const typename Arena::value_type, typename Arena::value_type>>;
+    using pointer = input_iterator_pointer<value_type>;
+    using reference = value_type;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::input_iterator_tag;
+    using iterator_concept = std::random_access_iterator_tag;
+
+    constexpr blob_iterator() noexcept = default;
+
+    constexpr blob_iterator(Arena *ref, const Ranges *elem, const difference_type idx) noexcept
+        : arena{ref},
+          ranges{elem},
+          offset{idx} {}
+
+    template<std::same_as<std::remove_const_t<Arena>> Other>
+    requires std::is_const_v<Arena>
+    constexpr blob_iterator(const blob_iterator<Other, Ranges> &other) noexcept
+        : blob_iterator{other.arena, other.ranges, other.offset} {}
+
+    constexpr blob_iterator &operator++() noexcept {
+        return --offset, *this;
+    }
+
+    constexpr blob_iterator operator++(int) noexcept {
+        const blob_iterator orig = *this;
+        return ++(*this), orig;
+    }
+
+    constexpr blob_iterator &operator--() noexcept {
+        return ++offset, *this;
+    }
+
+    constexpr blob_iterator operator--(int) noexcept {
+        const blob_iterator orig = *this;
+        return operator--(), orig;
+    }
+
+    constexpr blob_iterator &operator+=(const difference_type value) noexcept {
+        offset -= value;
+        return *this;
+    }
+
+    constexpr blob_iterator operator+(const difference_type value) const noexcept {
+        blob_iterator copy = *this;
+        return (copy += value);
+    }
+
+    constexpr blob_iterator &operator-=(const difference_type value) noexcept {
+        return (*this += -value);
+    }
+
+    constexpr blob_iterator operator-(const difference_type value) const noexcept {
+        return (*this + -value);
+    }
+
+    [[nodiscard]] constexpr reference operator[](const difference_type value) const noexcept {
+        const auto &elem = (*ranges)[static_cast<std::size_t>(index() - value)];
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        return reference{arena->data() + elem.offset, elem.length};
+    }
+
+    [[nodiscard]] constexpr pointer operator->() const noexcept {
+        return operator*();
+    }
+
+    [[nodiscard]] constexpr reference operator*() const noexcept {
+        return operator[](0);
+    }
+
+    template<typename Other>
+    [[nodiscard]] constexpr std::ptrdiff_t operator-(const blob_iterator<Other, Ranges> &other) const noexcept {
+        // intentionally reversed due to backward iteration
+        return other.offset - offset;
+    }
+
+    template<typename Other>
+    [[nodiscard]] constexpr bool operator==(const blob_iterator<Other, Ranges> &other) const noexcept {
+        return offset == other.offset;
+    }
+
+    template<typename Other>
+    [[nodiscard]] constexpr auto operator<=>(const blob_iterator<Other, Ranges> &other) const noexcept {
+        // intentionally reversed due to backward iteration
+        return other.offset <=> offset;
+    }
+
+    [[nodiscard]] constexpr difference_type index() const noexcept {
+        return offset - 1;
+    }
+
+private:
+    Arena *arena;
+    const Ranges *ranges;
+    difference_type offset;
+};
+
+} // namespace internal
+/*! @endcond */
+
+/**
+ * @brief Storage implementation.
+ *
+ * Internal data structures arrange elements to maximize performance. There are
+ * no guarantees that objects are returned in the insertion order when iterate
+ * a storage. Do not make assumption on the order in any case.
+ *
+ * @warning
+ * Empty types aren't explicitly instantiated. Therefore, many of the functions
+ * normally available for non-empty types will not be available for empty ones.
+ *
+ * @tparam Type Element type.
+ * @tparam Entity A valid entity type.
+ * @tparam Allocator Type of allocator used to manage memory and elements.
+ */
+template<typename Type, typename Entity, typename Allocator>
+class basic_storage: public basic_sparse_set<Entity, typename std::allocator_traits<Allocator>::template rebind_alloc<Entity>> {
+    using alloc_traits = std::allocator_traits<Allocator>;
+    static_assert(std::is_same_v<typename alloc_traits::value_type, Type>, "Invalid value type");
+    using container_type = std::vector<typename alloc_traits::pointer, typename alloc_traits::template rebind_alloc<typename alloc_traits::pointer>>;
+    using underlying_type = basic_sparse_set<Entity, typename alloc_traits::template rebind_alloc<Entity>>;
+    using underlying_iterator = underlying_type::basic_iterator;
+    using traits_type = component_traits<Type, Entity>;
+    using block_type = internal::page_block<internal::page_alignment_of<traits_type, Type>::value>;
+    using block_alloc_traits = alloc_traits::template rebind_traits<block_type>;
+
+    static constexpr bool is_over_aligned = (alignof(block_type) > alignof(Type));
+    static_assert(std::has_single_bit(alignof(block_type)), "Page alignment must be a power of two");
+
+    [[nodiscard]] auto &element_at(const std::size_t pos) const {
+        return payload[pos / traits_type::page_size][fast_mod(pos, traits_type::page_size)];
+    }
+
+    [[nodiscard]] auto allocate_page() {
+        allocator_type allocator{get_allocator()};
+
+        if constexpr(is_over_aligned) {
+            static_assert(std::is_pointer_v<typename alloc_traits::pointer>, "Fancy pointers not supported for over-aligned pages");
+            constexpr auto length = (sizeof(Type) * traits_type::page_size + sizeof(block_type) - 1u) / sizeof(block_type);
+            typename block_alloc_traits::allocator_type block_allocator{allocator};
+            return static_cast<typename alloc_traits::pointer>(static_cast<void *>(stl::to_address(block_alloc_traits::allocate(block_allocator, length))));
+        } else {
+            return alloc_traits::allocate(allocator, traits_type::page_size);
+        }
+    }
+
+    void deallocate_page(typename alloc_traits::pointer page) {
+        allocator_type allocator{get_allocator()};
+
+        if constexpr(is_over_aligned) {
+            constexpr auto length = (sizeof(Type) * traits_type::page_size + sizeof(block_type) - 1u) / sizeof(block_type);
+            typename block_alloc_traits::allocator_type block_allocator{allocator};
+            block_alloc_traits::deallocate(block_allocator, static_cast<block_type *>(static_cast<void *>(page)), length);
+        } else {
+            alloc_traits::deallocate(allocator, page, traits_type::page_size);
+        }
+    }
+
+    auto assure_at_least(const std::size_t pos) {
+        const auto idx = pos / traits_type::page_size;
+
+        if(!(idx < payload.size())) {
+            auto curr = payload.size();
+            payload.resize(idx + 1u, nullptr);
+
+            ENTT_TRY {
+                for(const auto last = payload.size(); curr < last; ++curr) {
+                    payload[curr] = allocate_page();
+                }
+            }
+            ENTT_CATCH {
+                payload.resize(curr);
+                ENTT_THROW;
+            }
+        }
+
+        return payload[idx] + fast_mod(pos, traits_type::page_size);
+    }
+
+    template<typename... Args>
+    auto emplace_element(const Entity entt, const bool force_back, Args &&...args) {
+        const auto it = base_type::try_emplace(entt, force_back);
+
+        ENTT_TRY {
+            auto *elem = stl::to_address(assure_at_least(static_cast<size_type>(it.index())));
+            entt::uninitialized_construct_using_allocator(elem, get_allocator(), std::forward<Args>(args)...);
+        }
+        ENTT_CATCH {
+            base_type::pop(it, it + 1u);
+            ENTT_THROW;
+        }
+
+        return it;
+    }
+
+    void shrink_to_size(const std::size_t sz) {
+        const auto from = (sz + traits_type::page_size - 1u) / traits_type::page_size;
+        allocator_type allocator{get_allocator()};
+
+        if constexpr(!std::is_trivially_destructible_v<element_type>) {
+            for(auto pos = sz, length = base_type::size(); pos < length; ++pos) {
+                if constexpr(traits_type::in_place_delete) {
+                    if(base_type::data()[pos] != tombstone) {
+                        alloc_traits::destroy(allocator, std::addressof(element_at(pos)));
+                    }
+                } else {
+                    alloc_traits::destroy(allocator, std::addressof(element_at(pos)));
+                }
+            }
+        }
+
+        for(auto pos = from, last = payload.size(); pos < last; ++pos) {
+            deallocate_page(payload[pos]);
+        }
+
+        payload.resize(from);
+        payload.shrink_to_fit();
+    }
+
+    void swap_at(const std::size_t lhs, const std::size_t rhs) {
+        using std::swap;
+        swap(element_at(lhs), element_at(rhs));
+    }
+
+    void move_to(const std::size_t lhs, const std::size_t rhs) {
+        auto &elem = element_at(lhs);
+        allocator_type allocator{get_allocator()};
+        entt::uninitialized_construct_using_allocator(stl::to_address(assure_at_least(rhs)), allocator, std::move(elem));
+        alloc_traits::destroy(allocator, std::addressof(elem));
+    }
+
+    template<typename Executor>
+    void relocate(Executor &jobs, const std::size_t *from, const std::size_t length) {
+        const auto count = (length + traits_type::page_size - 1u) / traits_type::page_size;
+        const auto last = (std::min)(count * traits_type::page_size, base_type::size());
+        container_type pages(count, nullptr, payload.get_allocator());
+        std::size_t curr{};
+
+        ENTT_TRY {
+            for(; curr < count; ++curr) {
+                pages[curr] = allocate_page();
+            }
+        }
+        ENTT_CATCH {
+            for(std::size_t pos{}; pos < curr; ++pos) {
+                deallocate_page(pages[pos]);
+            }
+
+            ENTT_THROW;
+        }
+
+        // elements are scattered to their new pages, each page is filled by a single job
+        jobs.parallel_for(count, [this, &pages, from, length, last](const std::size_t page) {
+            allocator_type page_allocator{get_allocator()};
+
+            for(auto pos = page * traits_type::page_size, end = (std::min)(pos + traits_type::page_size, last); pos < end; ++pos) {
+                auto *elem = stl::to_address(pages[page] + fast_mod(pos, traits_type::page_size));
+                entt::uninitialized_construct_using_allocator(elem, page_allocator, std::move(element_at((pos < length) ? from[pos] : pos)));
+            }
+        });
+
+        if constexpr(!std::is_trivially_destructible_v<element_type>) {
+            jobs.parallel_for(count, [this, last](const std::size_t page) {
+                allocator_type page_allocator{get_allocator()};
+
+                for(auto pos = page * traits_type::page_size, end = (std::min)(pos + traits_type::page_size, last); pos < end; ++pos) {
+                    alloc_traits::destroy(page_allocator, std::addressof(element_at(pos)));
+                }
+            });
+        }
+
+        for(std::size_t pos{}; pos < count; ++pos) {
+            deallocate_page(std::exchange(payload[pos], pages[pos]));
+        }
+    }
+
+private:
+    [[nodiscard]] const void *get_at(const std::size_t pos) const final {
+        return std::addressof(element_at(pos));
+    }
+
+    void swap_or_move([[maybe_unused]] const std::size_t from, [[maybe_unused]] const std::size_t to) override {
+        static constexpr bool is_pinned_type = !(std::is_move_constructible_v<Type> && std::is_move_assignable_v<Type>);
+        // use a runtime value to avoid compile-time suppression that drives the code coverage tool crazy
+        ENTT_ASSERT((from + 1u) && !is_pinned_type, "Pinned type");
+
+        if constexpr(!is_pinned_type) {
+            if constexpr(traits_type::in_place_delete) {
+                (base_type::operator[](to) == tombstone) ? move_to(from, to) : swap_at(from, to);
+            } else {
+                swap_at(from, to);
+            }
+        }
+    }
+
+protected:
+    /**
+     * @brief Erases entities from a storage.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     */
+    void pop(underlying_iterator first, underlying_iterator last) override {
+        for(allocator_type allocator{get_allocator()}; first != last; ++first) {
+            // cannot use first.index() because it would break with cross iterators
+            auto &elem = element_at(base_type::index(*first));
+
+            if constexpr(traits_type::in_place_delete) {
+                base_type::in_place_pop(*first);
+                alloc_traits::destroy(allocator, std::addressof(elem));
+            } else if constexpr(std::is_trivially_destructible_v<element_type>) {
+                elem = std::move(element_at(base_type::size() - 1u));
+                base_type::swap_and_pop(*first);
+            } else {
+                auto &other = element_at(base_type::size() - 1u);
+                // destroying on exit allows reentrant destructors
+                [[maybe_unused]] auto unused = std::exchange(elem, std::move(other));
+                alloc_traits::destroy(allocator, std::addressof(other));
+                base_type::swap_and_pop(*first);
+            }
+        }
+    }
+
+    /*! @brief Erases all entities of a storage. */
+    void pop_all() override {
+        if constexpr(std::is_trivially_destructible_v<element_type>) {
+            base_type::pop_all();
+        } else {
+            allocator_type allocator{get_allocator()};
+
+            for(auto first = base_type::begin(); !(first.index() < 0); ++first) {
+                if constexpr(traits_type::in_place_delete) {
+                    if(*first != tombstone) {
+                        base_type::in_place_pop(*first);
+                        alloc_traits::destroy(allocator, std::addressof(element_at(static_cast<size_type>(first.index()))));
+                    }
+                } else {
+                    base_type::swap_and_pop(*first);
+                    alloc_traits::destroy(allocator, std::addressof(element_at(static_cast<size_type>(first.index()))));
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Assigns an entity to a storage.
+     * @param entt A valid identifier.
+     * @param value Optional opaque value.
+     * @param force_back Force back insertion.
+     * @return Iterator pointing to the emplaced element.
+     */
+    underlying_iterator try_emplace([[maybe_unused]] const Entity entt, [[maybe_unused]] const bool force_back, const void *value) override {
+        if(value != nullptr) {
+            if constexpr(std::is_copy_constructible_v<element_type>) {
+                return emplace_element(entt, force_back, *static_cast<const element_type *>(value));
+            } else {
+                return base_type::end();
+            }
+        } else {
+            if constexpr(std::is_default_constructible_v<element_type>) {
+                return emplace_element(entt, force_back);
+            } else {
+                return base_type::end();
+            }
+        }
+    }
+
+public:
+    /*! @brief Allocator type. */
+    using allocator_type = Allocator;
+    /*! @brief Base type. */
+    using base_type = underlying_type;
+    /*! @brief Element type. */
+    using element_type = Type;
+    /*! @brief Type of the objects assigned to entities. */
+    using value_type = element_type;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Signed integer type. */
+    using difference_type = std::ptrdiff_t;
+    /*! @brief Pointer type to contained elements. */
+    using pointer = container_type::pointer;
+    /*! @brief Constant pointer type to contained elements. */
+    using const_pointer = alloc_traits::template rebind_traits<typename alloc_traits::const_pointer>::const_pointer;
+    /*! @brief Random access iterator type. */
+    using iterator = internal::storage_iterator<container_type, traits_type::page_size>;
+    /*! @brief Constant random access iterator type. */
+    using const_iterator = internal::storage_iterator<const container_type, traits_type::page_size>;
+    /*! @brief Reverse iterator type. */
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    /*! @brief Constant reverse iterator type. */
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+    /*! @brief Extended iterable storage proxy. */
+    using iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::iterator, iterator>>;
+    /*! @brief Constant extended iterable storage proxy. */
+    using const_iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::const_iterator, const_iterator>>;
+    /*! @brief Extended reverse iterable storage proxy. */
+    using reverse_iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::reverse_iterator, reverse_iterator>>;
+    /*! @brief Constant extended reverse iterable storage proxy. */
+    using const_reverse_iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::const_reverse_iterator, const_reverse_iterator>>;
+    /*! @brief Storage deletion policy. */
+    static constexpr deletion_policy storage_policy{traits_type::in_place_delete};
+
+    /*! @brief Default constructor. */
+    basic_storage()
+        : basic_storage{allocator_type{}} {}
+
+    /**
+     * @brief Constructs an empty storage with a given allocator.
+     * @param allocator The allocator to use.
+     */
+    explicit basic_storage(const allocator_type &allocator)
+        : base_type{type_id<element_type>(), storage_policy, allocator},
+          payload{allocator} {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_storage(const basic_storage &) = delete;
+
+    /**
+     * @brief Move constructor.
+     * @param other The instance to move from.
+     */
+    basic_storage(basic_storage &&other) noexcept
+        : base_type{static_cast<base_type &&>(other)},
+          payload{std::move(other.payload)} {}
+
+    /**
+     * @brief Allocator-extended move constructor.
+     * @param other The instance to move from.
+     * @param allocator The allocator to use.
+     */
+    basic_storage(basic_storage &&other, const allocator_type &allocator)
+        : base_type{static_cast<base_type &&>(other), allocator},
+          payload{std::move(other.payload), allocator} {
+        ENTT_ASSERT(alloc_traits::is_always_equal::value || get_allocator() == other.get_allocator(), "Copying a storage is not allowed");
+    }
+
+    /*! @brief Default destructor. */
+    // NOLINTNEXTLINE(bugprone-exception-escape)
+    ~basic_storage() override {
+        shrink_to_size(0u);
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This storage.
+     */
+    basic_storage &operator=(const basic_storage &) = delete;
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The instance to move from.
+     * @return This storage.
+     */
+    basic_storage &operator=(basic_storage &&other) noexcept {
+        ENTT_ASSERT(alloc_traits::is_always_equal::value || get_allocator() == other.get_allocator(), "Copying a storage is not allowed");
+        swap(other);
+        return *this;
+    }
+
+    /**
+     * @brief Exchanges the contents with those of a given storage.
+     * @param other Storage to exchange the content with.
+     */
+    void swap(basic_storage &other) noexcept {
+        using std::swap;
+        swap(payload, other.payload);
+        base_type::swap(other);
+    }
+
+    /**
+     * @brief Returns the associated allocator.
+     * @return The associated allocator.
+     */
+    [[nodiscard]] constexpr allocator_type get_allocator() const noexcept {
+        return payload.get_allocator();
+    }
+
+    /**
+     * @brief Increases the capacity of a storage.
+     *
+     * If the new capacity is greater than the current capacity, new storage is
+     * allocated, otherwise the method does nothing.
+     *
+     * @param cap Desired capacity.
+     */
+    void reserve(const size_type cap) override {
+        if(cap != 0u) {
+            base_type::reserve(cap);
+            assure_at_least(cap - 1u);
+        }
+    }
+
+    /**
+     * @brief Returns the number of elements that a storage has currently
+     * allocated space for.
+     * @return Capacity of the storage.
+     */
+    [[nodiscard]] size_type capacity() const noexcept override {
+        return payload.size() * traits_type::page_size;
+    }
+
+    /*! @brief Requests the removal of unused capacity. */
+    void shrink_to_fit() override {
+        base_type::shrink_to_fit();
+        shrink_to_size(base_type::size());
+    }
+
+    /**
+     * @brief Direct access to the array of objects.
+     * @return A pointer to the array of objects.
+     */
+    [[nodiscard]] const_pointer raw() const noexcept {
+        return payload.data();
+    }
+
+    /*! @copydoc raw */
+    [[nodiscard]] pointer raw() noexcept {
+        return payload.data();
+    }
+
+    /**
+     * @brief Returns an iterator to the beginning.
+     *
+     * If the storage is empty, the returned iterator will be equal to `end()`.
+     *
+     * @return An iterator to the first instance of the internal array.
+     */
+    [[nodiscard]] const_iterator cbegin() const noexcept {
+        const auto pos = static_cast<difference_type>(base_type::size());
+        return const_iterator{&payload, pos};
+    }
+
+    /*! @copydoc cbegin */
+    [[nodiscard]] const_iterator begin() const noexcept {
+        return cbegin();
+    }
+
+    /*! @copydoc begin */
+    [[nodiscard]] iterator begin() noexcept {
+        const auto pos = static_cast<difference_type>(base_type::size());
+        return iterator{&payload, pos};
+    }
+
+    /**
+     * @brief Returns an iterator to the end.
+     * @return An iterator to the element following the last instance of the
+     * internal array.
+     */
+    [[nodiscard]] const_iterator cend() const noexcept {
+        return const_iterator{&payload, {}};
+    }
+
+    /*! @copydoc cend */
+    [[nodiscard]] const_iterator end() const noexcept {
+        return cend();
+    }
+
+    /*! @copydoc end */
+    [[nodiscard]] iterator end() noexcept {
+        return iterator{&payload, {}};
+    }
+
+    /**
+     * @brief Returns a reverse iterator to the beginning.
+     *
+     * If the storage is empty, the returned iterator will be equal to `rend()`.
+     *
+     * @return An iterator to the first instance of the reversed internal array.
+     */
+    [[nodiscard]] const_reverse_iterator crbegin() const noexcept {
+        return std::make_reverse_iterator(cend());
+    }
+
+    /*! @copydoc crbegin */
+    [[nodiscard]] const_reverse_iterator rbegin() const noexcept {
+        return crbegin();
+    }
+
+    /*! @copydoc rbegin */
+    [[nodiscard]] reverse_iterator rbegin() noexcept {
+        return std::make_reverse_iterator(end());
+    }
+
+    /**
+     * @brief Returns a reverse iterator to the end.
+     * @return An iterator to the element following the last instance of the
+     * reversed internal array.
+     */
+    [[nodiscard]] const_reverse_iterator crend() const noexcept {
+        return std::make_reverse_iterator(cbegin());
+    }
+
+    /*! @copydoc crend */
+    [[nodiscard]] const_reverse_iterator rend() const noexcept {
+        return crend();
+    }
+
+    /*! @copydoc rend */
+    [[nodiscard]] reverse_iterator rend() noexcept {
+        return std::make_reverse_iterator(begin());
+    }
+
+    /**
+     * @brief Returns the object assigned to an entity.
+     *
+     * @warning
+     * Attempting to use an entity that doesn't belong to the storage results in
+     * undefined behavior.
+     *
+     * @param entt A valid identifier.
+     * @return The object assigned to the entity.
+     */
+    [[nodiscard]] const value_type &get(const entity_type entt) const noexcept {
+        return element_at(base_type::index(entt));
+    }
+
+    /*! @copydoc get */
+    [[nodiscard]] value_type &get(const entity_type entt) noexcept {
+        return const_cast<value_type &>(std::as_const(*this).get(entt));
+    }
+
+    /**
+     * @brief Returns the object assigned to an entity as a tuple.
+     * @param entt A valid identifier.
+     * @return The object assigned to the entity as a tuple.
+     */
+    [[nodiscard]] std::tuple<const value_type &> get_as_tuple(const entity_type entt) const noexcept {
+        return std::forward_as_tuple(get(entt));
+    }
+
+    /*! @copydoc get_as_tuple */
+    [[nodiscard]] std::tuple<value_type &> get_as_tuple(const entity_type entt) noexcept {
+        return std::forward_as_tuple(get(entt));
+    }
+
+    /**
+     * @brief Assigns an entity to a storage and constructs its object.
+     *
+     * @warning
+     * Attempting to use an entity that already belongs to the storage results
+     * in undefined behavior.
+     *
+     * @tparam Args Types of arguments to use to construct the object.
+     * @param entt A valid identifier.
+     * @param args Parameters to use to construct an object for the entity.
+     * @return A reference to the newly created object.
+     */
+    template<typename... Args>
+    value_type &emplace(const entity_type entt, Args &&...args) {
+        if constexpr(std::is_aggregate_v<value_type> && (sizeof...(Args) != 0u || !std::is_default_constructible_v<value_type>)) {
+            const auto it = emplace_element(entt, false, Type{std::forward<Args>(args)...});
+            return element_at(static_cast<size_type>(it.index()));
+        } else {
+            const auto it = emplace_element(entt, false, std::forward<Args>(args)...);
+            return element_at(static_cast<size_type>(it.index()));
+        }
+    }
+
+    /**
+     * @brief Updates the instance assigned to a given entity in-place.
+     * @tparam Func Types of the function objects to invoke.
+     * @param entt A valid identifier.
+     * @param func Valid function objects.
+     * @return A reference to the updated instance.
+     */
+    template<typename... Func>
+    value_type &patch(const entity_type entt, Func &&...func) {
+        const auto idx = base_type::index(entt);
+        auto &elem = element_at(idx);
+        (std::forward<Func>(func)(elem), ...);
+        return elem;
+    }
+
+    /**
+     * @brief Assigns one or more entities to a storage and constructs their
+     * objects from a given instance.
+     *
+     * @warning
+     * Attempting to assign an entity that already belongs to the storage
+     * results in undefined behavior.
+     *
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param value An instance of the object to construct.
+     * @return Iterator pointing to the first element inserted, if any.
+     */
+    iterator insert(stl::input_iterator auto first, stl::input_iterator auto last, const value_type &value = {}) {
+        for(; first != last; ++first) {
+            emplace_element(*first, true, value);
+        }
+
+        return begin();
+    }
+
+    /**
+     * @brief Assigns one or more entities to a storage and constructs their
+     * objects from a given range.
+     *
+     * @sa construct
+     *
+     * @tparam It Type of input iterator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param from An iterator to the first element of the range of objects.
+     * @return Iterator pointing to the first element inserted, if any.
+     */
+    template<stl::input_iterator It>
+    requires std::same_as<typename std::iterator_traits<It>::value_type, value_type>
+    iterator insert(stl::input_iterator auto first, stl::input_iterator auto last, It from) {
+        for(; first != last; ++first, ++from) {
+            emplace_element(*first, true, *from);
+        }
+
+        return begin();
+    }
+
+    /**
+     * @brief Returns an iterable object to use to _visit_ a storage.
+     *
+     * The iterable object returns a tuple that contains the current entity and
+     * a reference to its element.
+     *
+     * @return An iterable object to use to _visit_ the storage.
+     */
+    [[nodiscard]] iterable each() noexcept {
+        return iterable{{base_type::begin(), begin()}, {base_type::end(), end()}};
+    }
+
+    /*! @copydoc each */
+    [[nodiscard]] const_iterable each() const noexcept {
+        return const_iterable{{base_type::cbegin(), cbegin()}, {base_type::cend(), cend()}};
+    }
+
+    /**
+     * @brief Returns a reverse iterable object to use to _visit_ a storage.
+     *
+     * @sa each
+     *
+     * @return A reverse iterable object to use to _visit_ the storage.
+     */
+    [[nodiscard]] reverse_iterable reach() noexcept {
+        return reverse_iterable{{base_type::rbegin(), rbegin()}, {base_type::rend(), rend()}};
+    }
+
+    /*! @copydoc reach */
+    [[nodiscard]] const_reverse_iterable reach() const noexcept {
+        return const_reverse_iterable{{base_type::crbegin(), crbegin()}, {base_type::crend(), crend()}};
+    }
+
+    /**
+     * @brief Sort the first count elements according to the given comparison
+     * function, in parallel.
+     *
+     * Elements are moved to a new set of pages rather than swapped in place,
+     * so that each page is filled independently by means of the executor.
+     * Types that aren't nothrow move constructible fall back to the sequential
+     * permutation of the sparse set.
+     *
+     * @sa basic_sparse_set::par_sort_n
+     *
+     * @tparam Executor Type of executor.
+     * @tparam Compare Type of comparison function object.
+     * @tparam Sort Type of sort function object.
+     * @tparam Args Types of arguments to forward to the sort function object.
+     * @param jobs The executor to use to apply the permutation.
+     * @param length Number of elements to sort.
+     * @param compare A valid comparison function object.
+     * @param algo A valid sort function object.
+     * @param args Arguments to forward to the sort function object, if any.
+     */
+    template<typename Executor, typename Compare, typename Sort = std_sort, typename... Args>
+    void par_sort_n(Executor &jobs, const size_type length, Compare compare, Sort algo = Sort{}, Args &&...args) {
+        if constexpr(std::is_nothrow_move_constructible_v<element_type>) {
+            base_type::arrange_n(jobs, [this, &jobs](const size_type *from, const size_type len) { relocate(jobs, from, len); }, length, std::move(compare), std::move(algo), std::forward<Args>(args)...);
+        } else {
+            base_type::par_sort_n(jobs, length, std::move(compare), std::move(algo), std::forward<Args>(args)...);
+        }
+    }
+
+    /**
+     * @brief Sort all elements according to the given comparison function, in
+     * parallel.
+     *
+     * @sa par_sort_n
+     *
+     * @tparam Executor Type of executor.
+     * @tparam Compare Type of comparison function object.
+     * @tparam Sort Type of sort function object.
+     * @tparam Args Types of arguments to forward to the sort function object.
+     * @param jobs The executor to use to apply the permutation.
+     * @param compare A valid comparison function object.
+     * @param algo A valid sort function object.
+     * @param args Arguments to forward to the sort function object, if any.
+     */
+    template<typename Executor, typename Compare, typename Sort = std_sort, typename... Args>
+    void par_sort(Executor &jobs, Compare compare, Sort algo = Sort{}, Args &&...args) {
+        par_sort_n(jobs, base_type::size(), std::move(compare), std::move(algo), std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Sort entities according to their order in a range, in parallel.
+     *
+     * @sa par_sort_n
+     *
+     * @tparam Executor Type of executor.
+     * @tparam It Type of input iterator.
+     * @param jobs The executor to use to apply the permutation.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @return An iterator past the last of the elements actually shared.
+     */
+    template<typename Executor, stl::input_iterator It>
+    base_type::iterator par_sort_as(Executor &jobs, It first, It last) {
+        if constexpr(std::is_nothrow_move_constructible_v<element_type>) {
+            return base_type::arrange_as(jobs, [this, &jobs](const size_type *from, const size_type len) { relocate(jobs, from, len); }, std::move(first), std::move(last));
+        } else {
+            return base_type::par_sort_as(jobs, std::move(first), std::move(last));
+        }
+    }
+
+private:
+    container_type payload;
+};
+
+/**
+ * @brief No-pagination storage specialization.
+ *
+ * Elements are stored in a single contiguous array that is reallocated when it
+ * grows, rather than in pages. Accessing an element doesn't require any
+ * indirection and the whole array is returned by `raw`.
+ *
+ * @warning
+ * Pointer stability isn't supported, since elements are moved around every
+ * time the array is reallocated. Insertions invalidate references to elements
+ * but not iterators, that refer to elements by position.
+ *
+ * @tparam Type Element type.
+ * @tparam Entity A valid entity type.
+ * @tparam Allocator Type of allocator used to manage memory and elements.
+ */
+template<typename Type, typename Entity, typename Allocator>
+requires (component_traits<Type, Entity>::page_size == no_pagination)
+class basic_storage<Type, Entity, Allocator>
+    : public basic_sparse_set<Entity, typename std::allocator_traits<Allocator>::template rebind_alloc<Entity>> {
+    using alloc_traits = std::allocator_traits<Allocator>;
+    static_assert(std::is_same_v<typename alloc_traits::value_type, Type>, "Invalid value type");
+    using container_type = std::vector<Type, Allocator>;
+    using underlying_type = basic_sparse_set<Entity, typename alloc_traits::template rebind_alloc<Entity>>;
+    using underlying_iterator = underlying_type::basic_iterator;
+    using traits_type = component_traits<Type, Entity>;
+
+    static_assert(!traits_type::in_place_delete, "Pointer stability not supported");
+
+    template<typename... Args>
+    auto emplace_element(const Entity entt, const bool force_back, Args &&...args) {
+        const auto it = base_type::try_emplace(entt, force_back);
+
+        ENTT_TRY {
+            std::apply([this](auto &&...curr) { payload.emplace_back(std::forward<decltype(curr)>(curr)...); }, entt::uses_allocator_construction_args<Type>(payload.get_allocator(), std::forward<Args>(args)...));
+        }
+        ENTT_CATCH {
+            base_type::pop(it, it + 1u);
+            ENTT_THROW;
+        }
+
+        return it;
+    }
+
+    [[nodiscard]] const void *get_at(const std::size_t pos) const final {
+        return std::addressof(payload[pos]);
+    }
+
+    void swap_or_move(const std::size_t from, const std::size_t to) override {
+        using std::swap;
+        swap(payload[from], payload[to]);
+    }
+
+protected:
+    /**
+     * @brief Erases entities from a storage.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     */
+    void pop(underlying_iterator first, underlying_iterator last) override {
+        for(; first != last; ++first) {
+            // cannot use first.index() because it would break with cross iterators
+            auto &elem = payload[base_type::index(*first)];
+
+            if constexpr(std::is_trivially_destructible_v<element_type>) {
+                elem = std::move(payload.back());
+                payload.pop_back();
+                base_type::swap_and_pop(*first);
+            } else {
+                // destroying on exit allows reentrant destructors
+                [[maybe_unused]] auto unused = std::exchange(elem, std::move(payload.back()));
+                payload.pop_back();
+                base_type::swap_and_pop(*first);
+            }
+        }
+    }
+
+    /*! @brief Erases all entities of a storage. */
+    void pop_all() override {
+        if constexpr(std::is_trivially_destructible_v<element_type>) {
+            base_type::pop_all();
+            payload.clear();
+        } else {
+            for(auto first = base_type::begin(); !(first.index() < 0); ++first) {
+                base_type::swap_and_pop(*first);
+                payload.pop_back();
+            }
+        }
+    }
+
+    /**
+     * @brief Assigns an entity to a storage.
+     * @param entt A valid identifier.
+     * @param value Optional opaque value.
+     * @param force_back Force back insertion.
+     * @return Iterator pointing to the emplaced element.
+     */
+    underlying_iterator try_emplace([[maybe_unused]] const Entity entt, [[maybe_unused]] const bool force_back, const void *value) override {
+        if(value != nullptr) {
+            if constexpr(std::is_copy_constructible_v<element_type>) {
+                return emplace_element(entt, force_back, *static_cast<const element_type *>(value));
+            } else {
+                return base_type::end();
+            }
+        } else {
+            if constexpr(std::is_default_constructible_v<element_type>) {
+                return emplace_element(entt, force_back);
+            } else {
+                return base_type::end();
+            }
+        }
+    }
+
+public:
+    /*! @brief Allocator type. */
+    using allocator_type = Allocator;
+    /*! @brief Base type. */
+    using base_type = underlying_type;
+    /*! @brief Element type. */
+    using element_type = Type;
+    /*! @brief Type of the objects assigned to entities. */
+    using value_type = element_type;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Signed integer type. */
+    using difference_type = std::ptrdiff_t;
+    /*! @brief Pointer type to contained elements. */
+    using pointer = container_type::pointer;
+    /*! @brief Constant pointer type to contained elements. */
+    using const_pointer = container_type::const_pointer;
+    /*! @brief Random access iterator type. */
+    using iterator = internal::contiguous_storage_iterator<container_type>;
+    /*! @brief Constant random access iterator type. */
+    using const_iterator = internal::contiguous_storage_iterator<const container_type>;
+    /*! @brief Reverse iterator type. */
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    /*! @brief Constant reverse iterator type. */
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+    /*! @brief Extended iterable storage proxy. */
+    using iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::iterator, iterator>>;
+    /*! @brief Constant extended iterable storage proxy. */
+    using const_iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::const_iterator, const_iterator>>;
+    /*! @brief Extended reverse iterable storage proxy. */
+    using reverse_iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::reverse_iterator, reverse_iterator>>;
+    /*! @brief Constant extended reverse iterable storage proxy. */
+    using const_reverse_iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::const_reverse_iterator, const_reverse_iterator>>;
+    /*! @brief Storage deletion policy. */
+    static constexpr deletion_policy storage_policy{traits_type::in_place_delete};
+
+    /*! @brief Default constructor. */
+    basic_storage()
+        : basic_storage{allocator_type{}} {}
+
+    /**
+     * @brief Constructs an empty storage with a given allocator.
+     * @param allocator The allocator to use.
+     */
+    explicit basic_storage(const allocator_type &allocator)
+        : base_type{type_id<element_type>(), storage_policy, allocator},
+          payload{allocator} {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_storage(const basic_storage &) = delete;
+
+    /**
+     * @brief Move constructor.
+     * @param other The instance to move from.
+     */
+    basic_storage(basic_storage &&other) noexcept
+        : base_type{static_cast<base_type &&>(other)},
+          payload{std::move(other.payload)} {}
+
+    /**
+     * @brief Allocator-extended move constructor.
+     * @param other The instance to move from.
+     * @param allocator The allocator to use.
+     */
+    basic_storage(basic_storage &&other, const allocator_type &allocator)
+        : base_type{static_cast<base_type &&>(other), allocator},
+          payload{std::move(other.payload), allocator} {
+        ENTT_ASSERT(alloc_traits::is_always_equal::value || get_allocator() == other.get_allocator(), "Copying a storage is not allowed");
+    }
+
+    /*! @brief Default destructor. */
+    ~basic_storage() override = default;
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This storage.
+     */
+    basic_storage &operator=(const basic_storage &) = delete;
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The instance to move from.
+     * @return This storage.
+     */
+    basic_storage &operator=(basic_storage &&other) noexcept {
+        ENTT_ASSERT(alloc_traits::is_always_equal::value || get_allocator() == other.get_allocator(), "Copying a storage is not allowed");
+        swap(other);
+        return *this;
+    }
+
+    /**
+     * @brief Exchanges the contents with those of a given storage.
+     * @param other Storage to exchange the content with.
+     */
+    void swap(basic_storage &other) noexcept {
+        using std::swap;
+        swap(payload, other.payload);
+        base_type::swap(other);
+    }
+
+    /**
+     * @brief Returns the associated allocator.
+     * @return The associated allocator.
+     */
+    [[nodiscard]] constexpr allocator_type get_allocator() const noexcept {
+        return payload.get_allocator();
+    }
+
+    /**
+     * @brief Increases the capacity of a storage.
+     *
+     * If the new capacity is greater than the current capacity, new storage is
+     * allocated, otherwise the method does nothing.
+     *
+     * @param cap Desired capacity.
+     */
+    void reserve(const size_type cap) override {
+        base_type::reserve(cap);
+        payload.reserve(cap);
+    }
+
+    /**
+     * @brief Returns the number of elements that a storage has currently
+     * allocated space for.
+     * @return Capacity of the storage.
+     */
+    [[nodiscard]] size_type capacity() const noexcept override {
+        return payload.capacity();
+    }
+
+    /*! @brief Requests the removal of unused capacity. */
+    void shrink_to_fit() override {
+        base_type::shrink_to_fit();
+        payload.shrink_to_fit();
+    }
+
+    /**
+     * @brief Direct access to the array of objects.
+     *
+     * Objects are in the same order as the entities of the storage and the
+     * array is contiguous.
+     *
+     * @return A pointer to the array of objects.
+     */
+    [[nodiscard]] const_pointer raw() const noexcept {
+        return payload.data();
+    }
+
+    /*! @copydoc raw */
+    [[nodiscard]] pointer raw() noexcept {
+        return payload.data();
+    }
+
+    /**
+     * @brief Returns an iterator to the beginning.
+     *
+     * If the storage is empty, the returned iterator will be equal to `end()`.
+     *
+     * @return An iterator to the first instance of the internal array.
+     */
+    [[nodiscard]] const_iterator cbegin() const noexcept {
+        const auto pos = static_cast<difference_type>(payload.size());
+        return const_iterator{&payload, pos};
+    }
+
+    /*! @copydoc cbegin */
+    [[nodiscard]] const_iterator begin() const noexcept {
+        return cbegin();
+    }
+
+    /*! @copydoc begin */
+    [[nodiscard]] iterator begin() noexcept {
+        const auto pos = static_cast<difference_type>(payload.size());
+        return iterator{&payload, pos};
+    }
+
+    /**
+     * @brief Returns an iterator to the end.
+     * @return An iterator to the element following the last instance of the
+     * internal array.
+     */
+    [[nodiscard]] const_iterator cend() const noexcept {
+        return const_iterator{&payload, {}};
+    }
+
+    /*! @copydoc cend */
+    [[nodiscard]] const_iterator end() const noexcept {
+        return cend();
+    }
+
+    /*! @copydoc end */
+    [[nodiscard]] iterator end() noexcept {
+        return iterator{&payload, {}};
+    }
+
+    /**
+     * @brief Returns a reverse iterator to the beginning.
+     *
+     * If the storage is empty, the returned iterator will be equal to `rend()`.
+     *
+     * @return An iterator to the first instance of the reversed internal array.
+     */
+    [[nodiscard]] const_reverse_iterator crbegin() const noexcept {
+        return std::make_reverse_iterator(cend());
+    }
+
+    /*! @copydoc crbegin */
+    [[nodiscard]] const_reverse_iterator rbegin() const noexcept {
+        return crbegin();
+    }
+
+    /*! @copydoc rbegin */
+    [[nodiscard]] reverse_iterator rbegin() noexcept {
+        return std::make_reverse_iterator(end());
+    }
+
+    /**
+     * @brief Returns a reverse iterator to the end.
+     * @return An iterator to the element following the last instance of the
+     * reversed internal array.
+     */
+    [[nodiscard]] const_reverse_iterator crend() const noexcept {
+        return std::make_reverse_iterator(cbegin());
+    }
+
+    /*! @copydoc crend */
+    [[nodiscard]] const_reverse_iterator rend() const noexcept {
+        return crend();
+    }
+
+    /*! @copydoc rend */
+    [[nodiscard]] reverse_iterator rend() noexcept {
+        return std::make_reverse_iterator(begin());
+    }
+
+    /**
+     * @brief Returns the object assigned to an entity.
+     *
+     * @warning
+     * Attempting to use an entity that doesn't belong to the storage results in
+     * undefined behavior.
+     *
+     * @param entt A valid identifier.
+     * @return The object assigned to the entity.
+     */
+    [[nodiscard]] const value_type &get(const entity_type entt) const noexcept {
+        return payload[base_type::index(entt)];
+    }
+
+    /*! @copydoc get */
+    [[nodiscard]] value_type &get(const entity_type entt) noexcept {
+        return payload[base_type::index(entt)];
+    }
+
+    /**
+     * @brief Returns the object assigned to an entity as a tuple.
+     * @param entt A valid identifier.
+     * @return The object assigned to the entity as a tuple.
+     */
+    [[nodiscard]] std::tuple<const value_type &> get_as_tuple(const entity_type entt) const noexcept {
+        return std::forward_as_tuple(get(entt));
+    }
+
+    /*! @copydoc get_as_tuple */
+    [[nodiscard]] std::tuple<value_type &> get_as_tuple(const entity_type entt) noexcept {
+        return std::forward_as_tuple(get(entt));
+    }
+
+    /**
+     * @brief Assigns an entity to a storage and constructs its object.
+     *
+     * @warning
+     * Attempting to use an entity that already belongs to the storage results
+     * in undefined behavior.
+     *
+     * @tparam Args Types of arguments to use to construct the object.
+     * @param entt A valid identifier.
+     * @param args Parameters to use to construct an object for the entity.
+     * @return A reference to the newly created object.
+     */
+    template<typename... Args>
+    value_type &emplace(const entity_type entt, Args &&...args) {
+        if constexpr(std::is_aggregate_v<value_type> && (sizeof...(Args) != 0u || !std::is_default_constructible_v<value_type>)) {
+            const auto it = emplace_element(entt, false, Type{std::forward<Args>(args)...});
+            return payload[static_cast<size_type>(it.index())];
+        } else {
+            const auto it = emplace_element(entt, false, std::forward<Args>(args)...);
+            return payload[static_cast<size_type>(it.index())];
+        }
+    }
+
+    /**
+     * @brief Updates the instance assigned to a given entity in-place.
+     * @tparam Func Types of the function objects to invoke.
+     * @param entt A valid identifier.
+     * @param func Valid function objects.
+     * @return A reference to the updated instance.
+     */
+    template<typename... Func>
+    value_type &patch(const entity_type entt, Func &&...func) {
+        auto &elem = payload[base_type::index(entt)];
+        (std::forward<Func>(func)(elem), ...);
+        return elem;
+    }
+
+    /**
+     * @brief Assigns one or more entities to a storage and constructs their
+     * objects from a given instance.
+     *
+     * @warning
+     * Attempting to assign an entity that already belongs to the storage
+     * results in undefined behavior.
+     *
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param value An instance of the object to construct.
+     * @return Iterator pointing to the first element inserted, if any.
+     */
+    iterator insert(stl::input_iterator auto first, stl::input_iterator auto last, const value_type &value = {}) {
+        for(; first != last; ++first) {
+            emplace_element(*first, true, value);
+        }
+
+        return begin();
+    }
+
+    /**
+     * @brief Assigns one or more entities to a storage and constructs their
+     * objects from a given range.
+     *
+     * @sa construct
+     *
+     * @tparam It Type of input iterator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param from An iterator to the first element of the range of objects.
+     * @return Iterator pointing to the first element inserted, if any.
+     */
+    template<stl::input_iterator It>
+    requires std::same_as<typename std::iterator_traits<It>::value_type, value_type>
+    iterator insert(stl::input_iterator auto first, stl::input_iterator auto last, It from) {
+        for(; first != last; ++first, ++from) {
+            emplace_element(*first, true, *from);
+        }
+
+        return begin();
+    }
+
+    /**
+     * @brief Returns an iterable object to use to _visit_ a storage.
+     *
+     * The iterable object returns a tuple that contains the current entity and
+     * a reference to its element.
+     *
+     * @return An iterable object to use to _visit_ the storage.
+     */
+    [[nodiscard]] iterable each() noexcept {
+        return iterable{{base_type::begin(), begin()}, {base_type::end(), end()}};
+    }
+
+    /*! @copydoc each */
+    [[nodiscard]] const_iterable each() const noexcept {
+        return const_iterable{{base_type::cbegin(), cbegin()}, {base_type::cend(), cend()}};
+    }
+
+    /**
+     * @brief Returns a reverse iterable object to use to _visit_ a storage.
+     *
+     * @sa each
+     *
+     * @return A reverse iterable object to use to _visit_ the storage.
+     */
+    [[nodiscard]] reverse_iterable reach() noexcept {
+        return reverse_iterable{{base_type::rbegin(), rbegin()}, {base_type::rend(), rend()}};
+    }
+
+    /*! @copydoc reach */
+    [[nodiscard]] const_reverse_iterable reach() const noexcept {
+        return const_reverse_iterable{{base_type::crbegin(), crbegin()}, {base_type::crend(), crend()}};
+    }
+
+private:
+    container_type payload;
+};
+
+/*! @copydoc basic_storage */
+template<typename Type, typename Entity, typename Allocator>
+requires (component_traits<Type, Entity>::page_size == 0u) && (!internal::bitset_tagged<component_traits<Type, Entity>>)
+class basic_storage<Type, Entity, Allocator>
+    : public basic_sparse_set<Entity, typename std::allocator_traits<Allocator>::template rebind_alloc<Entity>> {
+    using alloc_traits = std::allocator_traits<Allocator>;
+    static_assert(std::is_same_v<typename alloc_traits::value_type, Type>, "Invalid value type");
+    using traits_type = component_traits<Type, Entity>;
+
+public:
+    /*! @brief Allocator type. */
+    using allocator_type = Allocator;
+    /*! @brief Base type. */
+    using base_type = basic_sparse_set<Entity, typename alloc_traits::template rebind_alloc<Entity>>;
+    /*! @brief Element type. */
+    using element_type = Type;
+    /*! @brief Type of the objects assigned to entities. */
+    using value_type = void;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Signed integer type. */
+    using difference_type = std::ptrdiff_t;
+    /*! @brief Extended iterable storage proxy. */
+    using iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::iterator>>;
+    /*! @brief Constant extended iterable storage proxy. */
+    using const_iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::const_iterator>>;
+    /*! @brief Extended reverse iterable storage proxy. */
+    using reverse_iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::reverse_iterator>>;
+    /*! @brief Constant extended reverse iterable storage proxy. */
+    using const_reverse_iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::const_reverse_iterator>>;
+    /*! @brief Storage deletion policy. */
+    static constexpr deletion_policy storage_policy{traits_type::in_place_delete};
+
+    /*! @brief Default constructor. */
+    basic_storage()
+        : basic_storage{allocator_type{}} {}
+
+    /**
+     * @brief Constructs an empty container with a given allocator.
+     * @param allocator The allocator to use.
+     */
+    explicit basic_storage(const allocator_type &allocator)
+        : base_type{type_id<element_type>(), storage_policy, allocator} {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_storage(const basic_storage &) = delete;
+
+    /**
+     * @brief Move constructor.
+     * @param other The instance to move from.
+     */
+    basic_storage(basic_storage &&other) noexcept = default;
+
+    /**
+     * @brief Allocator-extended move constructor.
+     * @param other The instance to move from.
+     * @param allocator The allocator to use.
+     */
+    basic_storage(basic_storage &&other, const allocator_type &allocator)
+        : base_type{std::move(other), allocator} {}
+
+    /*! @brief Default destructor. */
+    ~basic_storage() override = default;
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This storage.
+     */
+    basic_storage &operator=(const basic_storage &) = delete;
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The instance to move from.
+     * @return This storage.
+     */
+    basic_storage &operator=(basic_storage &&other) noexcept = default;
+
+    /**
+     * @brief Returns the associated allocator.
+     * @return The associated allocator.
+     */
+    [[nodiscard]] constexpr allocator_type get_allocator() const noexcept {
+        return allocator_type{base_type::get_allocator()};
+    }
+
+    /**
+     * @brief Returns the object assigned to an entity, that is `void`.
+     *
+     * @warning
+     * Attempting to use an entity that doesn't belong to the storage results in
+     * undefined behavior.
+     *
+     * @param entt A valid identifier.
+     */
+    void get([[maybe_unused]] const entity_type entt) const noexcept {
+        ENTT_ASSERT(base_type::contains(entt), "Invalid entity");
+    }
+
+    /**
+     * @brief Returns an empty tuple.
+     * @param entt A valid identifier.
+     * @return Returns an empty tuple.
+     */
+    [[nodiscard]] std::tuple<> get_as_tuple([[maybe_unused]] const entity_type entt) const noexcept {
+        ENTT_ASSERT(base_type::contains(entt), "Invalid entity");
+        return std::tuple{};
+    }
+
+    /**
+     * @brief Assigns an entity to a storage and constructs its object.
+     *
+     * @warning
+     * Attempting to use an entity that already belongs to the storage results
+     * in undefined behavior.
+     *
+     * @param entt A valid identifier.
+     */
+    void emplace(const entity_type entt, const auto &...) {
+        base_type::try_emplace(entt, false);
+    }
+
+    /**
+     * @brief Updates the instance assigned to a given entity in-place.
+     * @tparam Func Types of the function objects to invoke.
+     * @param entt A valid identifier.
+     * @param func Valid function objects.
+     */
+    template<typename... Func>
+    void patch([[maybe_unused]] const entity_type entt, Func &&...func) {
+        ENTT_ASSERT(base_type::contains(entt), "Invalid entity");
+        (std::forward<Func>(func)(), ...);
+    }
+
+    /**
+     * @brief Assigns entities to a storage.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     */
+    void insert(stl::input_iterator auto first, stl::input_iterator auto last, const auto &...) {
+        for(; first != last; ++first) {
+            base_type::try_emplace(*first, true);
+        }
+    }
+
+    /**
+     * @brief Returns an iterable object to use to _visit_ a storage.
+     *
+     * The iterable object returns a tuple that contains the current entity.
+     *
+     * @return An iterable object to use to _visit_ the storage.
+     */
+    [[nodiscard]] iterable each() noexcept {
+        return iterable{base_type::begin(), base_type::end()};
+    }
+
+    /*! @copydoc each */
+    [[nodiscard]] const_iterable each() const noexcept {
+        return const_iterable{base_type::cbegin(), base_type::cend()};
+    }
+
+    /**
+     * @brief Returns a reverse iterable object to use to _visit_ a storage.
+     *
+     * @sa each
+     *
+     * @return A reverse iterable object to use to _visit_ the storage.
+     */
+    [[nodiscard]] reverse_iterable reach() noexcept {
+        return reverse_iterable{{base_type::rbegin()}, {base_type::rend()}};
+    }
+
+    /*! @copydoc reach */
+    [[nodiscard]] const_reverse_iterable reach() const noexcept {
+        return const_reverse_iterable{{base_type::crbegin()}, {base_type::crend()}};
+    }
+};
+
+/**
+ * @brief Bitset-backed tag storage specialization.
+ *
+ * Empty types that set `bitset_tag` keep track of their entities in a bitset
+ * over entity identifiers, in addition to the sparse set. Membership tests
+ * are answered by the bitset first and the sparse set is only queried to
+ * confirm the version of the entities that pass them.<br/>
+ * Views route their membership tests through the storage classes, therefore
+ * excluding a bitset-backed tag costs a single bit test for most entities.
+ *
+ * @note
+ * The bitset doesn't replace the sparse set. These pools take more memory than
+ * plain tag pools, that is, one more bit for each identifier up to the largest
+ * one in use.
+ *
+ * @tparam Type Element type.
+ * @tparam Entity A valid entity type.
+ * @tparam Allocator Type of allocator used to manage memory and elements.
+ */
+template<typename Type, typename Entity, typename Allocator>
+requires internal::bitset_tagged<component_traits<Type, Entity>>
+class basic_storage<Type, Entity, Allocator>
+    : public basic_sparse_set<Entity, typename std::allocator_traits<Allocator>::template rebind_alloc<Entity>> {
+    using alloc_traits = std::allocator_traits<Allocator>;
+    static_assert(std::is_same_v<typename alloc_traits::value_type, Type>, "Invalid value type");
+    using underlying_type = basic_sparse_set<Entity, typename alloc_traits::template rebind_alloc<Entity>>;
+    using underlying_iterator = underlying_type::basic_iterator;
+    using traits_type = component_traits<Type, Entity>;
+
+    auto emplace_element(const Entity entt, const bool force_back, const void *value = nullptr) {
+        const auto it = underlying_type::try_emplace(entt, force_back, value);
+
+        ENTT_TRY {
+            bits.set(static_cast<std::size_t>(entt::to_entity(entt)));
+        }
+        ENTT_CATCH {
+            underlying_type::pop(it, it + 1u);
+            ENTT_THROW;
+        }
+
+        return it;
+    }
+
+protected:
+    /**
+     * @brief Erases entities from a storage.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     */
+    void pop(underlying_iterator first, underlying_iterator last) override {
+        for(auto it = first; it != last; ++it) {
+            bits.reset(static_cast<size_type>(entt::to_entity(*it)));
+        }
+
+        underlying_type::pop(first, last);
+    }
+
+    /*! @brief Erases all entities of a storage. */
+    void pop_all() override {
+        bits.clear();
+        underlying_type::pop_all();
+    }
+
+    /**
+     * @brief Assigns an entity to a storage.
+     * @param entt A valid identifier.
+     * @param force_back Force back insertion.
+     * @param value Optional opaque value.
+     * @return Iterator pointing to the emplaced element.
+     */
+    underlying_iterator try_emplace(const Entity entt, const bool force_back, const void *value) override {
+        return emplace_element(entt, force_back, value);
+    }
+
+public:
+    /*! @brief Allocator type. */
+    using allocator_type = Allocator;
+    /*! @brief Base type. */
+    using base_type = underlying_type;
+    /*! @brief Element type. */
+    using element_type = Type;
+    /*! @brief Type of the objects assigned to entities. */
+    using value_type = void;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Signed integer type. */
+    using difference_type = std::ptrdiff_t;
+    /*! @brief Bitset type. */
+    using bitset_type = basic_bitset<typename alloc_traits::template rebind_alloc<std::uint64_t>>;
+    /*! @brief Extended iterable storage proxy. */
+    using iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::iterator>>;
+    /*! @brief Constant extended iterable storage proxy. */
+    using const_iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::const_iterator>>;
+    /*! @brief Extended reverse iterable storage proxy. */
+    using reverse_iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::reverse_iterator>>;
+    /*! @brief Constant extended reverse iterable storage proxy. */
+    using const_reverse_iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::const_reverse_iterator>>;
+    /*! @brief Storage deletion policy. */
+    static constexpr deletion_policy storage_policy{traits_type::in_place_delete};
+
+    /*! @brief Default constructor. */
+    basic_storage()
+        : basic_storage{allocator_type{}} {}
+
+    /**
+     * @brief Constructs an empty container with a given allocator.
+     * @param allocator The allocator to use.
+     */
+    explicit basic_storage(const allocator_type &allocator)
+        : base_type{type_id<element_type>(), storage_policy, allocator},
+          bits{allocator} {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_storage(const basic_storage &) = delete;
+
+    /**
+     * @brief Move constructor.
+     * @param other The instance to move from.
+     */
+    basic_storage(basic_storage &&other) noexcept
+        : base_type{static_cast<base_type &&>(other)},
+          bits{std::move(other.bits)} {}
+
+    /**
+     * @brief Allocator-extended move constructor.
+     * @param other The instance to move from.
+     * @param allocator The allocator to use.
+     */
+    basic_storage(basic_storage &&other, const allocator_type &allocator)
+        : base_type{static_cast<base_type &&>(other), allocator},
+          bits{std::move(other.bits), allocator} {}
+
+    /*! @brief Default destructor. */
+    ~basic_storage() override = default;
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This storage.
+     */
+    basic_storage &operator=(const basic_storage &) = delete;
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The instance to move from.
+     * @return This storage.
+     */
+    basic_storage &operator=(basic_storage &&other) noexcept {
+        swap(other);
+        return *this;
+    }
+
+    /**
+     * @brief Exchanges the contents with those of a given storage.
+     * @param other Storage to exchange the content with.
+     */
+    void swap(basic_storage &other) noexcept {
+        bits.swap(other.bits);
+        base_type::swap(other);
+    }
+
+    /**
+     * @brief Returns the associated allocator.
+     * @return The associated allocator.
+     */
+    [[nodiscard]] constexpr allocator_type get_allocator() const noexcept {
+        return allocator_type{base_type::get_allocator()};
+    }
+
+    /**
+     * @brief Checks if a storage contains an entity.
+     * @param entt A valid identifier.
+     * @return True if the storage contains the entity, false otherwise.
+     */
+    [[nodiscard]] bool contains(const entity_type entt) const noexcept {
+        return bits.test(static_cast<size_type>(entt::to_entity(entt))) && base_type::contains(entt);
+    }
+
+    /**
+     * @brief Returns the bitset of the identifiers of the entities.
+     * @return The bitset of the identifiers of the entities.
+     */
+    [[nodiscard]] const bitset_type &bitset() const noexcept {
+        return bits;
+    }
+
+    /**
+     * @brief Returns the object assigned to an entity, that is `void`.
+     *
+     * @warning
+     * Attempting to use an entity that doesn't belong to the storage results in
+     * undefined behavior.
+     *
+     * @param entt A valid identifier.
+     */
+    void get([[maybe_unused]] const entity_type entt) const noexcept {
+        ENTT_ASSERT(contains(entt), "Invalid entity");
+    }
+
+    /**
+     * @brief Returns an empty tuple.
+     * @param entt A valid identifier.
+     * @return Returns an empty tuple.
+     */
+    [[nodiscard]] std::tuple<> get_as_tuple([[maybe_unused]] const entity_type entt) const noexcept {
+        ENTT_ASSERT(contains(entt), "Invalid entity");
+        return std::tuple{};
+    }
+
+    /**
+     * @brief Assigns an entity to a storage and constructs its object.
+     *
+     * @warning
+     * Attempting to use an entity that already belongs to the storage results
+     * in undefined behavior.
+     *
+     * @param entt A valid identifier.
+     */
+    void emplace(const entity_type entt, const auto &...) {
+        emplace_element(entt, false);
+    }
+
+    /**
+     * @brief Updates the instance assigned to a given entity in-place.
+     * @tparam Func Types of the function objects to invoke.
+     * @param entt A valid identifier.
+     * @param func Valid function objects.
+     */
+    template<typename... Func>
+    void patch([[maybe_unused]] const entity_type entt, Func &&...func) {
+        ENTT_ASSERT(contains(entt), "Invalid entity");
+        (std::forward<Func>(func)(), ...);
+    }
+
+    /**
+     * @brief Assigns entities to a storage.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     */
+    void insert(stl::input_iterator auto first, stl::input_iterator auto last, const auto &...) {
+        for(; first != last; ++first) {
+            emplace_element(*first, true);
+        }
+    }
+
+    /**
+     * @brief Returns an iterable object to use to _visit_ a storage.
+     *
+     * The iterable object returns a tuple that contains the current entity.
+     *
+     * @return An iterable object to use to _visit_ the storage.
+     */
+    [[nodiscard]] iterable each() noexcept {
+        return iterable{base_type::begin(), base_type::end()};
+    }
+
+    /*! @copydoc each */
+    [[nodiscard]] const_iterable each() const noexcept {
+        return const_iterable{base_type::cbegin(), base_type::cend()};
+    }
+
+    /**
+     * @brief Returns a reverse iterable object to use to _visit_ a storage.
+     *
+     * @sa each
+     *
+     * @return A reverse iterable object to use to _visit_ the storage.
+     */
+    [[nodiscard]] reverse_iterable reach() noexcept {
+        return reverse_iterable{{base_type::rbegin()}, {base_type::rend()}};
+    }
+
+    /*! @copydoc reach */
+    [[nodiscard]] const_reverse_iterable reach() const noexcept {
+        return const_reverse_iterable{{base_type::crbegin()}, {base_type::crend()}};
+    }
+
+private:
+    bitset_type bits;
+};
+
+/**
+ * @brief Column storage specialization.
+ *
+ * Data members of an element are stored in separate paged arrays (namely
+ * _columns_), one for each of the members listed by the component traits.
+ * Elements are returned as proxy objects to access their members by reference
+ * or to convert them to actual instances.<br/>
+ * This layout is such that iterating a single member is cache friendly and
+ * eventually vectorized by the compiler.
+ *
+ * @warning
+ * Columns must cover all data members of an element and its type must be
+ * default constructible. Pointer stability isn't supported.
+ *
+ * @tparam Type Element type.
+ * @tparam Entity A valid entity type.
+ * @tparam Allocator Type of allocator used to manage memory and elements.
+ */
+template<typename Type, typename Entity, typename Allocator>
+requires internal::columnar<component_traits<Type, Entity>>
+class basic_storage<Type, Entity, Allocator>
+    : public basic_sparse_set<Entity, typename std::allocator_traits<Allocator>::template rebind_alloc<Entity>> {
+    using alloc_traits = std::allocator_traits<Allocator>;
+    static_assert(std::is_same_v<typename alloc_traits::value_type, Type>, "Invalid value type");
+    using underlying_type = basic_sparse_set<Entity, typename alloc_traits::template rebind_alloc<Entity>>;
+    using underlying_iterator = underlying_type::basic_iterator;
+    using traits_type = component_traits<Type, Entity>;
+    using columns_type = traits_type::columns;
+    using layout_type = internal::column_layout<Type, Allocator, columns_type>;
+    using container_type = layout_type::container_type;
+
+    static_assert(!traits_type::in_place_delete, "Pointer stability not supported");
+    static_assert(std::is_default_constructible_v<Type>, "Default constructible type required");
+    static_assert(layout_type::is_nothrow_movable, "Nothrow movable columns required");
+    static_assert(layout_type::is_complete, "Columns must cover all data members");
+
+    template<typename Pages>
+    using column_traits = alloc_traits::template rebind_traits<typename std::pointer_traits<typename Pages::value_type>::element_type>;
+
+    template<typename Pages>
+    [[nodiscard]] static auto &element_at(Pages &pages, const std::size_t pos) {
+        return pages[pos / traits_type::page_size][fast_mod(pos, traits_type::page_size)];
+    }
+
+    template<typename Func>
+    void visit(Func func) {
+        [this, &func]<std::size_t... Index>(std::index_sequence<Index...>) {
+            (func(std::get<Index>(payload), value_list_element_v<Index, columns_type>), ...);
+        }(std::make_index_sequence<columns_type::size>{});
+    }
+
+    void assure_at_least(const std::size_t pos) {
+        if(const auto idx = pos / traits_type::page_size; !(idx < std::get<0>(payload).size())) {
+            const auto curr = std::get<0>(payload).size();
+
+            ENTT_TRY {
+                visit([this, idx](auto &pages, auto) {
+                    typename column_traits<std::remove_reference_t<decltype(pages)>>::allocator_type allocator{get_allocator()};
+                    pages.resize(idx + 1u, nullptr);
+
+                    for(auto &&page: pages) {
+                        if(page == nullptr) {
+                            page = column_traits<std::remove_reference_t<decltype(pages)>>::allocate(allocator, traits_type::page_size);
+                        }
+                    }
+                });
+            }
+            ENTT_CATCH {
+                visit([this, curr](auto &pages, auto) {
+                    typename column_traits<std::remove_reference_t<decltype(pages)>>::allocator_type allocator{get_allocator()};
+
+                    for(auto next = curr, last = pages.size(); next < last && pages[next] != nullptr; ++next) {
+                        column_traits<std::remove_reference_t<decltype(pages)>>::deallocate(allocator, pages[next], traits_type::page_size);
+                    }
+
+                    pages.resize(curr);
+                });
+
+                ENTT_THROW;
+            }
+        }
+    }
+
+    auto emplace_element(const Entity entt, const bool force_back, Type value) {
+        const auto it = base_type::try_emplace(entt, force_back);
+        const auto pos = static_cast<size_type>(it.index());
+
+        ENTT_TRY {
+            assure_at_least(pos);
+        }
+        ENTT_CATCH {
+            base_type::pop(it, it + 1u);
+            ENTT_THROW;
+        }
+
+        // columns are nothrow movable, no need to roll back from here on
+        visit([this, pos, &value](auto &pages, auto member) {
+            typename column_traits<std::remove_reference_t<decltype(pages)>>::allocator_type allocator{get_allocator()};
+            auto *elem = stl::to_address(pages[pos / traits_type::page_size] + fast_mod(pos, traits_type::page_size));
+            entt::uninitialized_construct_using_allocator(elem, allocator, std::move(value.*member));
+        });
+
+        return it;
+    }
+
+    void shrink_to_size(const std::size_t sz) {
+        const auto from = (sz + traits_type::page_size - 1u) / traits_type::page_size;
+
+        visit([this, sz, from](auto &pages, auto) {
+            using column_alloc_traits = column_traits<std::remove_reference_t<decltype(pages)>>;
+            typename column_alloc_traits::allocator_type allocator{get_allocator()};
+
+            if constexpr(!std::is_trivially_destructible_v<typename column_alloc_traits::value_type>) {
+                for(auto pos = sz, length = base_type::size(); pos < length; ++pos) {
+                    column_alloc_traits::destroy(allocator, std::addressof(element_at(pages, pos)));
+                }
+            }
+
+            for(auto pos = from, last = pages.size(); pos < last; ++pos) {
+                column_alloc_traits::deallocate(allocator, pages[pos], traits_type::page_size);
+            }
+
+            pages.resize(from);
+            pages.shrink_to_fit();
+        });
+    }
+
+    void swap_or_move(const std::size_t from, const std::size_t to) override {
+        visit([from, to](auto &pages, auto) {
+            using std::swap;
+            swap(element_at(pages, from), element_at(pages, to));
+        });
+    }
+
+protected:
+    /**
+     * @brief Erases entities from a storage.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     */
+    void pop(underlying_iterator first, underlying_iterator last) override {
+        for(; first != last; ++first) {
+            // cannot use first.index() because it would break with cross iterators
+            const auto pos = base_type::index(*first);
+            const auto back = base_type::size() - 1u;
+
+            visit([this, pos, back](auto &pages, auto) {
+                using column_alloc_traits = column_traits<std::remove_reference_t<decltype(pages)>>;
+                auto &elem = element_at(pages, pos);
+                auto &other = element_at(pages, back);
+
+                if constexpr(std::is_trivially_destructible_v<typename column_alloc_traits::value_type>) {
+                    elem = std::move(other);
+                } else {
+                    typename column_alloc_traits::allocator_type allocator{get_allocator()};
+                    // destroying on exit allows reentrant destructors
+                    [[maybe_unused]] auto unused = std::exchange(elem, std::move(other));
+                    column_alloc_traits::destroy(allocator, std::addressof(other));
+                }
+            });
+
+            base_type::swap_and_pop(*first);
+        }
+    }
+
+    /*! @brief Erases all entities of a storage. */
+    void pop_all() override {
+        visit([this](auto &pages, auto) {
+            using column_alloc_traits = column_traits<std::remove_reference_t<decltype(pages)>>;
+
+            if constexpr(!std::is_trivially_destructible_v<typename column_alloc_traits::value_type>) {
+                typename column_alloc_traits::allocator_type allocator{get_allocator()};
+
+                for(size_type pos{}, length = base_type::size(); pos < length; ++pos) {
+                    column_alloc_traits::destroy(allocator, std::addressof(element_at(pages, pos)));
+                }
+            }
+        });
+
+        base_type::pop_all();
+    }
+
+    /**
+     * @brief Assigns an entity to a storage.
+     * @param entt A valid identifier.
+     * @param value Optional opaque value.
+     * @param force_back Force back insertion.
+     * @return Iterator pointing to the emplaced element.
+     */
+    underlying_iterator try_emplace(const Entity entt, const bool force_back, const void *value) override {
+        if(value != nullptr) {
+            if constexpr(std::is_copy_constructible_v<element_type>) {
+                return emplace_element(entt, force_back, *static_cast<const element_type *>(value));
+            } else {
+                return base_type::end();
+            }
+        }
+
+        return emplace_element(entt, force_back, element_type{});
+    }
+
+public:
+    /*! @brief Allocator type. */
+    using allocator_type = Allocator;
+    /*! @brief Base type. */
+    using base_type = underlying_type;
+    /*! @brief Element type. */
+    using element_type = Type;
+    /*! @brief Type of the objects assigned to entities. */
+    using value_type = element_type;
+    /*! @brief Proxy type to access the columns of an element. */
+    using reference = layout_type::reference;
+    /*! @brief Constant proxy type to access the columns of an element. */
+    using const_reference = layout_type::const_reference;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Signed integer type. */
+    using difference_type = std::ptrdiff_t;
+    /*! @brief Random access iterator type. */
+    using iterator = internal::column_iterator<container_type, reference, traits_type::page_size>;
+    /*! @brief Constant random access iterator type. */
+    using const_iterator = internal::column_iterator<const container_type, const_reference, traits_type::page_size>;
+    /*! @brief Reverse iterator type. */
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    /*! @brief Constant reverse iterator type. */
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+    /*! @brief Extended iterable storage proxy. */
+    using iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::iterator, iterator>>;
+    /*! @brief Constant extended iterable storage proxy. */
+    using const_iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::const_iterator, const_iterator>>;
+    /*! @brief Extended reverse iterable storage proxy. */
+    using reverse_iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::reverse_iterator, reverse_iterator>>;
+    /*! @brief Constant extended reverse iterable storage proxy. */
+    using const_reverse_iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::const_reverse_iterator, const_reverse_iterator>>;
+    /*! @brief Storage deletion policy. */
+    static constexpr deletion_policy storage_policy{traits_type::in_place_delete};
+
+    /*! @brief Default constructor. */
+    basic_storage()
+        : basic_storage{allocator_type{}} {}
+
+    /**
+     * @brief Constructs an empty storage with a given allocator.
+     * @param allocator The allocator to use.
+     */
+    explicit basic_storage(const allocator_type &allocator)
+        : base_type{type_id<element_type>(), storage_policy, allocator},
+          payload{[&allocator]<std::size_t... Index>(std::index_sequence<Index...>) { return container_type{std::tuple_element_t<Index, container_type>(allocator)...}; }(std::make_index_sequence<columns_type::size>{})} {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_storage(const basic_storage &) = delete;
+
+    /**
+     * @brief Move constructor.
+     * @param other The instance to move from.
+     */
+    basic_storage(basic_storage &&other) noexcept
+        : base_type{static_cast<base_type &&>(other)},
+          payload{std::move(other.payload)} {}
+
+    /**
+     * @brief Allocator-extended move constructor.
+     * @param other The instance to move from.
+     * @param allocator The allocator to use.
+     */
+    basic_storage(basic_storage &&other, const allocator_type &allocator)
+        : base_type{static_cast<base_type &&>(other), allocator},
+          payload{std::apply([&allocator](auto &...pages) { return container_type{std::remove_reference_t<decltype(pages)>{std::move(pages), allocator}...}; }, other.payload)} {
+        ENTT_ASSERT(alloc_traits::is_always_equal::value || get_allocator() == other.get_allocator(), "Copying a storage is not allowed");
+    }
+
+    /*! @brief Default destructor. */
+    // NOLINTNEXTLINE(bugprone-exception-escape)
+    ~basic_storage() override {
+        shrink_to_size(0u);
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This storage.
+     */
+    basic_storage &operator=(const basic_storage &) = delete;
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The instance to move from.
+     * @return This storage.
+     */
+    basic_storage &operator=(basic_storage &&other) noexcept {
+        ENTT_ASSERT(alloc_traits::is_always_equal::value || get_allocator() == other.get_allocator(), "Copying a storage is not allowed");
+        swap(other);
+        return *this;
+    }
+
+    /**
+     * @brief Exchanges the contents with those of a given storage.
+     * @param other Storage to exchange the content with.
+     */
+    void swap(basic_storage &other) noexcept {
+        using std::swap;
+        swap(payload, other.payload);
+        base_type::swap(other);
+    }
+
+    /**
+     * @brief Returns the associated allocator.
+     * @return The associated allocator.
+     */
+    [[nodiscard]] constexpr allocator_type get_allocator() const noexcept {
+        return allocator_type{std::get<0>(payload).get_allocator()};
+    }
+
+    /**
+     * @brief Increases the capacity of a storage.
+     *
+     * If the new capacity is greater than the current capacity, new storage is
+     * allocated, otherwise the method does nothing.
+     *
+     * @param cap Desired capacity.
+     */
+    void reserve(const size_type cap) override {
+        if(cap != 0u) {
+            base_type::reserve(cap);
+            assure_at_least(cap - 1u);
+        }
+    }
+
+    /**
+     * @brief Returns the number of elements that a storage has currently
+     * allocated space for.
+     * @return Capacity of the storage.
+     */
+    [[nodiscard]] size_type capacity() const noexcept override {
+        return std::get<0>(payload).size() * traits_type::page_size;
+    }
+
+    /*! @brief Requests the removal of unused capacity. */
+    void shrink_to_fit() override {
+        base_type::shrink_to_fit();
+        shrink_to_size(base_type::size());
+    }
+
+    /**
+     * @brief Direct access to the pages of a column.
+     *
+     * Each page contains exactly `component_traits<Type>::page_size` slots and
+     * elements are in the same order as the entities of the storage.
+     *
+     * @tparam Member Data member of which to return the column.
+     * @return A pointer to the array of pages of the given column.
+     */
+    template<auto Member>
+    [[nodiscard]] auto raw() const noexcept {
+        using column_pointer = std::allocator_traits<typename std::tuple_element_t<value_list_index_v<Member, columns_type>, container_type>::allocator_type>::const_pointer;
+        return column_pointer{std::get<value_list_index_v<Member, columns_type>>(payload).data()};
+    }
+
+    /*! @copydoc raw */
+    template<auto Member>
+    [[nodiscard]] auto raw() noexcept {
+        return std::get<value_list_index_v<Member, columns_type>>(payload).data();
+    }
+
+    /**
+     * @brief Returns an iterator to the beginning.
+     *
+     * If the storage is empty, the returned iterator will be equal to `end()`.
+     *
+     * @return An iterator to the first instance of the internal array.
+     */
+    [[nodiscard]] const_iterator cbegin() const noexcept {
+        const auto pos = static_cast<difference_type>(base_type::size());
+        return const_iterator{&payload, pos};
+    }
+
+    /*! @copydoc cbegin */
+    [[nodiscard]] const_iterator begin() const noexcept {
+        return cbegin();
+    }
+
+    /*! @copydoc begin */
+    [[nodiscard]] iterator begin() noexcept {
+        const auto pos = static_cast<difference_type>(base_type::size());
+        return iterator{&payload, pos};
+    }
+
+    /**
+     * @brief Returns an iterator to the end.
+     * @return An iterator to the element following the last instance of the
+     * internal array.
+     */
+    [[nodiscard]] const_iterator cend() const noexcept {
+        return const_iterator{&payload, {}};
+    }
+
+    /*! @copydoc cend */
+    [[nodiscard]] const_iterator end() const noexcept {
+        return cend();
+    }
+
+    /*! @copydoc end */
+    [[nodiscard]] iterator end() noexcept {
+        return iterator{&payload, {}};
+    }
+
+    /**
+     * @brief Returns a reverse iterator to the beginning.
+     *
+     * If the storage is empty, the returned iterator will be equal to `rend()`.
+     *
+     * @return An iterator to the first instance of the reversed internal array.
+     */
+    [[nodiscard]] const_reverse_iterator crbegin() const noexcept {
+        return std::make_reverse_iterator(cend());
+    }
+
+    /*! @copydoc crbegin */
+    [[nodiscard]] const_reverse_iterator rbegin() const noexcept {
+        return crbegin();
+    }
+
+    /*! @copydoc rbegin */
+    [[nodiscard]] reverse_iterator rbegin() noexcept {
+        return std::make_reverse_iterator(end());
+    }
+
+    /**
+     * @brief Returns a reverse iterator to the end.
+     * @return An iterator to the element following the last instance of the
+     * reversed internal array.
+     */
+    [[nodiscard]] const_reverse_iterator crend() const noexcept {
+        return std::make_reverse_iterator(cbegin());
+    }
+
+    /*! @copydoc crend */
+    [[nodiscard]] const_reverse_iterator rend() const noexcept {
+        return crend();
+    }
+
+    /*! @copydoc rend */
+    [[nodiscard]] reverse_iterator rend() noexcept {
+        return std::make_reverse_iterator(begin());
+    }
+
+    /**
+     * @brief Returns a proxy to the object assigned to an entity.
+     *
+     * @warning
+     * Attempting to use an entity that doesn't belong to the storage results in
+     * undefined behavior.
+     *
+     * @param entt A valid identifier.
+     * @return A proxy to the object assigned to the entity.
+     */
+    [[nodiscard]] const_reference get(const entity_type entt) const noexcept {
+        return cbegin()[static_cast<difference_type>(base_type::size() - base_type::index(entt) - 1u)];
+    }
+
+    /*! @copydoc get */
+    [[nodiscard]] reference get(const entity_type entt) noexcept {
+        return begin()[static_cast<difference_type>(base_type::size() - base_type::index(entt) - 1u)];
+    }
+
+    /**
+     * @brief Returns a proxy to the object assigned to an entity as a tuple.
+     * @param entt A valid identifier.
+     * @return A proxy to the object assigned to the entity as a tuple.
+     */
+    [[nodiscard]] std::tuple<const_reference> get_as_tuple(const entity_type entt) const noexcept {
+        return std::make_tuple(get(entt));
+    }
+
+    /*! @copydoc get_as_tuple */
+    [[nodiscard]] std::tuple<reference> get_as_tuple(const entity_type entt) noexcept {
+        return std::make_tuple(get(entt));
+    }
+
+    /**
+     * @brief Assigns an entity to a storage and constructs its object.
+     *
+     * @warning
+     * Attempting to use an entity that already belongs to the storage results
+     * in undefined behavior.
+     *
+     * @tparam Args Types of arguments to use to construct the object.
+     * @param entt A valid identifier.
+     * @param args Parameters to use to construct an object for the entity.
+     * @return A proxy to the newly created object.
+     */
+    template<typename... Args>
+    reference emplace(const entity_type entt, Args &&...args) {
+        if constexpr(std::is_aggregate_v<value_type> && (sizeof...(Args) != 0u || !std::is_default_constructible_v<value_type>)) {
+            emplace_element(entt, false, Type{std::forward<Args>(args)...});
+        } else {
+            emplace_element(entt, false, Type(std::forward<Args>(args)...));
+        }
+
+        return get(entt);
+    }
+
+    /**
+     * @brief Updates the instance assigned to a given entity in-place.
+     * @tparam Func Types of the function objects to invoke.
+     * @param entt A valid identifier.
+     * @param func Valid function objects.
+     * @return A proxy to the updated instance.
+     */
+    template<typename... Func>
+    reference patch(const entity_type entt, Func &&...func) {
+        auto elem = get(entt);
+        (std::forward<Func>(func)(elem), ...);
+        return elem;
+    }
+
+    /**
+     * @brief Assigns one or more entities to a storage and constructs their
+     * objects from a given instance.
+     *
+     * @warning
+     * Attempting to assign an entity that already belongs to the storage
+     * results in undefined behavior.
+     *
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param value An instance of the object to construct.
+     * @return Iterator pointing to the first element inserted, if any.
+     */
+    iterator insert(stl::input_iterator auto first, stl::input_iterator auto last, const value_type &value = {}) {
+        for(; first != last; ++first) {
+            emplace_element(*first, true, value);
+        }
+
+        return begin();
+    }
 
-    constexpr extended_storage_iterator(iterator_type base, Other... other)
-        : it{base, other...} {}
+    /**
+     * @brief Assigns one or more entities to a storage and constructs their
+     * objects from a given range.
+     *
+     * @sa construct
+     *
+     * @tparam It Type of input iterator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param from An iterator to the first element of the range of objects.
+     * @return Iterator pointing to the first element inserted, if any.
+     */
+    template<stl::input_iterator It>
+    requires std::same_as<typename std::iterator_traits<It>::value_type, value_type>
+    iterator insert(stl::input_iterator auto first, stl::input_iterator auto last, It from) {
+        for(; first != last; ++first, ++from) {
+            emplace_element(*first, true, *from);
+        }
 
-    template<typename... Args>
-    requires (!std::same_as<Other, Args> && ...) && (std::constructible_from<Other, Args> && ...)
-    constexpr extended_storage_iterator(const extended_storage_iterator<It, Args...> &other)
-        : it{other.it} {}
+        return begin();
+    }
 
-    constexpr extended_storage_iterator &operator++() noexcept {
-        return ++std::get<It>(it), (++std::get<Other>(it), ...), *this;
+    /**
+     * @brief Returns an iterable object to use to _visit_ a storage.
+     *
+     * The iterable object returns a tuple that contains the current entity and
+     * a proxy to its element.
+     *
+     * @return An iterable object to use to _visit_ the storage.
+     */
+    [[nodiscard]] iterable each() noexcept {
+        return iterable{{base_type::begin(), begin()}, {base_type::end(), end()}};
     }
 
-    constexpr extended_storage_iterator operator++(int) noexcept {
-        const extended_storage_iterator orig = *this;
-        return ++(*this), orig;
+    /*! @copydoc each */
+    [[nodiscard]] const_iterable each() const noexcept {
+        return const_iterable{{base_type::cbegin(), cbegin()}, {base_type::cend(), cend()}};
     }
 
-    [[nodiscard]] constexpr pointer operator->() const noexcept {
-        return operator*();
+    /**
+     * @brief Returns an iterable object to use to _visit_ a single column.
+     *
+     * The iterable object returns a tuple that contains the current entity and
+     * a reference to the given data member of its element. Other columns
+     * aren't touched during iterations, which makes it suitable to split
+     * frequently accessed data from the rest of an element.
+     *
+     * @tparam Member Data member of which to visit the column.
+     * @return An iterable object to use to _visit_ the column.
+     */
+    template<auto Member>
+    [[nodiscard]] auto each() noexcept {
+        using column_iterator = internal::storage_iterator<std::tuple_element_t<value_list_index_v<Member, columns_type>, container_type>, traits_type::page_size>;
+        auto *pages = &std::get<value_list_index_v<Member, columns_type>>(payload);
+        const auto pos = static_cast<difference_type>(base_type::size());
+        return iterable_adaptor<internal::extended_storage_iterator<typename base_type::iterator, column_iterator>>{{base_type::begin(), column_iterator{pages, pos}}, {base_type::end(), column_iterator{pages, {}}}};
     }
 
-    [[nodiscard]] constexpr reference operator*() const noexcept {
-        return {*std::get<It>(it), *std::get<Other>(it)...};
+    /*! @copydoc each */
+    template<auto Member>
+    [[nodiscard]] auto each() const noexcept {
+        using column_iterator = internal::storage_iterator<const std::tuple_element_t<value_list_index_v<Member, columns_type>, container_type>, traits_type::page_size>;
+        const auto *pages = &std::get<value_list_index_v<Member, columns_type>>(payload);
+        const auto pos = static_cast<difference_type>(base_type::size());
+        return iterable_adaptor<internal::extended_storage_iterator<typename base_type::const_iterator, column_iterator>>{{base_type::cbegin(), column_iterator{pages, pos}}, {base_type::cend(), column_iterator{pages, {}}}};
     }
 
-    [[nodiscard]] constexpr iterator_type base() const noexcept {
-        return std::get<It>(it);
+    /**
+     * @brief Returns a reverse iterable object to use to _visit_ a storage.
+     *
+     * @sa each
+     *
+     * @return A reverse iterable object to use to _visit_ the storage.
+     */
+    [[nodiscard]] reverse_iterable reach() noexcept {
+        return reverse_iterable{{base_type::rbegin(), rbegin()}, {base_type::rend(), rend()}};
     }
 
-    template<typename... Args>
-    [[nodiscard]] constexpr bool operator==(const extended_storage_iterator<Args...> &other) const noexcept {
-        return std::get<0>(it) == std::get<0>(other.it);
+    /*! @copydoc reach */
+    [[nodiscard]] const_reverse_iterable reach() const noexcept {
+        return const_reverse_iterable{{base_type::crbegin(), crbegin()}, {base_type::crend(), crend()}};
     }
 
 private:
-    std::tuple<It, Other...> it;
+    container_type payload;
 };
 
-} // namespace internal
-/*! @endcond */
-
 /**
- * @brief Storage implementation.
+ * @brief Blob storage specialization.
  *
- * Internal data structures arrange elements to maximize performance. There are
- * no guarantees that objects are returned in the insertion order when iterate
- * a storage. Do not make assumption on the order in any case.
+ * Each entity is assigned a variable length sequence of elements. Sequences are
+ * stored one after the other in a single arena that belongs to the storage, so
+ * that there is no allocation per entity and data are close in memory.<br/>
+ * Elements are returned as spans rather than references.
+ *
+ * Removing an entity leaves its elements in the arena until the next
+ * compaction. This happens automatically once the arena contains more unused
+ * elements than live ones, as well as upon `shrink_to_fit`. After a compaction,
+ * sequences are laid out in the same order as their entities.
  *
  * @warning
- * Empty types aren't explicitly instantiated. Therefore, many of the functions
- * normally available for non-empty types will not be available for empty ones.
+ * Spans are invalidated by insertions and removals. Pointer stability isn't
+ * supported by this kind of storage.
  *
- * @tparam Type Element type.
+ * @tparam Type Type of elements in the sequences.
  * @tparam Entity A valid entity type.
  * @tparam Allocator Type of allocator used to manage memory and elements.
  */
 template<typename Type, typename Entity, typename Allocator>
-class basic_storage: public basic_sparse_set<Entity, typename std::allocator_traits<Allocator>::template rebind_alloc<Entity>> {
+class basic_storage<blob_t<Type>, Entity, Allocator>
+    : public basic_sparse_set<Entity, typename std::allocator_traits<Allocator>::template rebind_alloc<Entity>> {
     using alloc_traits = std::allocator_traits<Allocator>;
-    static_assert(std::is_same_v<typename alloc_traits::value_type, Type>, "Invalid value type");
-    using container_type = std::vector<typename alloc_traits::pointer, typename alloc_traits::template rebind_alloc<typename alloc_traits::pointer>>;
+    static_assert(std::is_same_v<typename alloc_traits::value_type, blob_t<Type>>, "Invalid value type");
     using underlying_type = basic_sparse_set<Entity, typename alloc_traits::template rebind_alloc<Entity>>;
     using underlying_iterator = underlying_type::basic_iterator;
-    using traits_type = component_traits<Type, Entity>;
+    using arena_type = std::vector<Type, typename alloc_traits::template rebind_alloc<Type>>;
+    using ranges_type = std::vector<internal::blob_range, typename alloc_traits::template rebind_alloc<internal::blob_range>>;
 
-    [[nodiscard]] auto &element_at(const std::size_t pos) const {
-        return payload[pos / traits_type::page_size][fast_mod(pos, traits_type::page_size)];
+    static_assert(std::is_same_v<Type, std::decay_t<Type>>, "Non-decayed types not allowed");
+    static_assert(std::is_nothrow_move_constructible_v<Type> && std::is_nothrow_move_assignable_v<Type>, "Nothrow movable types required");
+
+    void append(const Type *elem, const std::size_t length) {
+        if(length != 0u && !std::less<const Type *>{}(elem, arena.data()) && std::less<const Type *>{}(elem, arena.data() + arena.size())) {
+            // the sequence is part of the arena, push_back is alias-safe
+            for(auto pos = static_cast<std::size_t>(elem - arena.data()), last = pos + length; pos < last; ++pos) {
+                arena.push_back(arena[pos]);
+            }
+        } else {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            arena.insert(arena.end(), elem, elem + length);
+        }
     }
 
-    auto assure_at_least(const std::size_t pos) {
-        const auto idx = pos / traits_type::page_size;
+    auto emplace_element(const Entity entt, const bool force_back, const std::span<const Type> value) {
+        const auto it = base_type::try_emplace(entt, force_back);
+        const auto offset = arena.size();
 
-        if(!(idx < payload.size())) {
-            auto curr = payload.size();
-            allocator_type allocator{get_allocator()};
-            payload.resize(idx + 1u, nullptr);
+        ENTT_TRY {
+            ranges.push_back(internal::blob_range{offset, 0u});
 
             ENTT_TRY {
-                for(const auto last = payload.size(); curr < last; ++curr) {
-                    payload[curr] = alloc_traits::allocate(allocator, traits_type::page_size);
-                }
+                append(value.data(), value.size());
             }
             ENTT_CATCH {
-                payload.resize(curr);
+                arena.erase(arena.begin() + static_cast<difference_type>(offset), arena.end());
+                ranges.pop_back();
                 ENTT_THROW;
             }
         }
-
-        return payload[idx] + fast_mod(pos, traits_type::page_size);
-    }
-
-    template<typename... Args>
-    auto emplace_element(const Entity entt, const bool force_back, Args &&...args) {
-        const auto it = base_type::try_emplace(entt, force_back);
-
-        ENTT_TRY {
-            auto *elem = stl::to_address(assure_at_least(static_cast<size_type>(it.index())));
-            entt::uninitialized_construct_using_allocator(elem, get_allocator(), std::forward<Args>(args)...);
-        }
         ENTT_CATCH {
             base_type::pop(it, it + 1u);
             ENTT_THROW;
         }
 
+        ranges.back().length = value.size();
+        used += value.size();
+
         return it;
     }
 
-    void shrink_to_size(const std::size_t sz) {
-        const auto from = (sz + traits_type::page_size - 1u) / traits_type::page_size;
-        allocator_type allocator{get_allocator()};
-
-        if constexpr(!std::is_trivially_destructible_v<element_type>) {
-            for(auto pos = sz, length = base_type::size(); pos < length; ++pos) {
-                if constexpr(traits_type::in_place_delete) {
-                    if(base_type::data()[pos] != tombstone) {
-                        alloc_traits::destroy(allocator, std::addressof(element_at(pos)));
-                    }
-                } else {
-                    alloc_traits::destroy(allocator, std::addressof(element_at(pos)));
-                }
-            }
-        }
+    void compact_arena() {
+        arena_type other{arena.get_allocator()};
+        other.reserve(used);
 
-        for(auto pos = from, last = payload.size(); pos < last; ++pos) {
-            alloc_traits::deallocate(allocator, payload[pos], traits_type::page_size);
+        // elements are nothrow movable, no need to roll back from here on
+        for(auto &&elem: ranges) {
+            const auto first = arena.begin() + static_cast<difference_type>(elem.offset);
+            elem.offset = other.size();
+            other.insert(other.end(), std::make_move_iterator(first), std::make_move_iterator(first + static_cast<difference_type>(elem.length)));
         }
 
-        payload.resize(from);
-        payload.shrink_to_fit();
-    }
-
-    void swap_at(const std::size_t lhs, const std::size_t rhs) {
-        using std::swap;
-        swap(element_at(lhs), element_at(rhs));
-    }
-
-    void move_to(const std::size_t lhs, const std::size_t rhs) {
-        auto &elem = element_at(lhs);
-        allocator_type allocator{get_allocator()};
-        entt::uninitialized_construct_using_allocator(stl::to_address(assure_at_least(rhs)), allocator, std::move(elem));
-        alloc_traits::destroy(allocator, std::addressof(elem));
-    }
-
-private:
-    [[nodiscard]] const void *get_at(const std::size_t pos) const final {
-        return std::addressof(element_at(pos));
+        arena.swap(other);
     }
 
-    void swap_or_move([[maybe_unused]] const std::size_t from, [[maybe_unused]] const std::size_t to) override {
-        static constexpr bool is_pinned_type = !(std::is_move_constructible_v<Type> && std::is_move_assignable_v<Type>);
-        // use a runtime value to avoid compile-time suppression that drives the code coverage tool crazy
-        ENTT_ASSERT((from + 1u) && !is_pinned_type, "Pinned type");
-
-        if constexpr(!is_pinned_type) {
-            if constexpr(traits_type::in_place_delete) {
-                (base_type::operator[](to) == tombstone) ? move_to(from, to) : swap_at(from, to);
-            } else {
-                swap_at(from, to);
-            }
-        }
+    void swap_or_move(const std::size_t from, const std::size_t to) override {
+        std::swap(ranges[from], ranges[to]);
     }
 
 protected:
@@ -319,45 +3026,28 @@ protected:
      * @param last An iterator past the last element of the range of entities.
      */
     void pop(underlying_iterator first, underlying_iterator last) override {
-        for(allocator_type allocator{get_allocator()}; first != last; ++first) {
+        for(; first != last; ++first) {
             // cannot use first.index() because it would break with cross iterators
-            auto &elem = element_at(base_type::index(*first));
+            auto &elem = ranges[base_type::index(*first)];
+            used -= elem.length;
+            elem = ranges.back();
+            ranges.pop_back();
+            base_type::swap_and_pop(*first);
+        }
 
-            if constexpr(traits_type::in_place_delete) {
-                base_type::in_place_pop(*first);
-                alloc_traits::destroy(allocator, std::addressof(elem));
-            } else if constexpr(std::is_trivially_destructible_v<element_type>) {
-                elem = std::move(element_at(base_type::size() - 1u));
-                base_type::swap_and_pop(*first);
-            } else {
-                auto &other = element_at(base_type::size() - 1u);
-                // destroying on exit allows reentrant destructors
-                [[maybe_unused]] auto unused = std::exchange(elem, std::move(other));
-                alloc_traits::destroy(allocator, std::addressof(other));
-                base_type::swap_and_pop(*first);
-            }
+        if(used == 0u) {
+            arena.clear();
+        } else if((arena.size() - used) > used) {
+            compact_arena();
         }
     }
 
     /*! @brief Erases all entities of a storage. */
     void pop_all() override {
-        if constexpr(std::is_trivially_destructible_v<element_type>) {
-            base_type::pop_all();
-        } else {
-            allocator_type allocator{get_allocator()};
-
-            for(auto first = base_type::begin(); !(first.index() < 0); ++first) {
-                if constexpr(traits_type::in_place_delete) {
-                    if(*first != tombstone) {
-                        base_type::in_place_pop(*first);
-                        alloc_traits::destroy(allocator, std::addressof(element_at(static_cast<size_type>(first.index()))));
-                    }
-                } else {
-                    base_type::swap_and_pop(*first);
-                    alloc_traits::destroy(allocator, std::addressof(element_at(static_cast<size_type>(first.index()))));
-                }
-            }
-        }
+        base_type::pop_all();
+        ranges.clear();
+        arena.clear();
+        used = 0u;
     }
 
     /**
@@ -367,19 +3057,15 @@ protected:
      * @param force_back Force back insertion.
      * @return Iterator pointing to the emplaced element.
      */
-    underlying_iterator try_emplace([[maybe_unused]] const Entity entt, [[maybe_unused]] const bool force_back, const void *value) override {
+    underlying_iterator try_emplace(const Entity entt, const bool force_back, const void *value) override {
         if(value != nullptr) {
-            if constexpr(std::is_copy_constructible_v<element_type>) {
-                return emplace_element(entt, force_back, *static_cast<const element_type *>(value));
+            if constexpr(std::is_copy_constructible_v<Type>) {
+                return emplace_element(entt, force_back, *static_cast<const value_type *>(value));
             } else {
                 return base_type::end();
             }
         } else {
-            if constexpr(std::is_default_constructible_v<element_type>) {
-                return emplace_element(entt, force_back);
-            } else {
-                return base_type::end();
-            }
+            return emplace_element(entt, force_back, value_type{});
         }
     }
 
@@ -389,23 +3075,23 @@ public:
     /*! @brief Base type. */
     using base_type = underlying_type;
     /*! @brief Element type. */
-    using element_type = Type;
+    using element_type = blob_t<Type>;
     /*! @brief Type of the objects assigned to entities. */
-    using value_type = element_type;
+    using value_type = std::span<const Type>;
     /*! @brief Underlying entity identifier. */
     using entity_type = Entity;
     /*! @brief Unsigned integer type. */
     using size_type = std::size_t;
     /*! @brief Signed integer type. */
     using difference_type = std::ptrdiff_t;
-    /*! @brief Pointer type to contained elements. */
-    using pointer = container_type::pointer;
-    /*! @brief Constant pointer type to contained elements. */
-    using const_pointer = alloc_traits::template rebind_traits<typename alloc_traits::const_pointer>::const_pointer;
+    /*! @brief Reference type to the objects assigned to entities. */
+    using reference = std::span<Type>;
+    /*! @brief Constant reference type to the objects assigned to entities. */
+    using const_reference = std::span<const Type>;
     /*! @brief Random access iterator type. */
-    using iterator = internal::storage_iterator<container_type, traits_type::page_size>;
+    using iterator = internal::blob_iterator<arena_type, ranges_type>;
     /*! @brief Constant random access iterator type. */
-    using const_iterator = internal::storage_iterator<const container_type, traits_type::page_size>;
+    using const_iterator = internal::blob_iterator<const arena_type, ranges_type>;
     /*! @brief Reverse iterator type. */
     using reverse_iterator = std::reverse_iterator<iterator>;
     /*! @brief Constant reverse iterator type. */
@@ -419,7 +3105,7 @@ public:
     /*! @brief Constant extended reverse iterable storage proxy. */
     using const_reverse_iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::const_reverse_iterator, const_reverse_iterator>>;
     /*! @brief Storage deletion policy. */
-    static constexpr deletion_policy storage_policy{traits_type::in_place_delete};
+    static constexpr deletion_policy storage_policy{deletion_policy::swap_and_pop};
 
     /*! @brief Default constructor. */
     basic_storage()
@@ -431,7 +3117,8 @@ public:
      */
     explicit basic_storage(const allocator_type &allocator)
         : base_type{type_id<element_type>(), storage_policy, allocator},
-          payload{allocator} {}
+          arena{allocator},
+          ranges{allocator} {}
 
     /*! @brief Default copy constructor, deleted on purpose. */
     basic_storage(const basic_storage &) = delete;
@@ -442,7 +3129,9 @@ public:
      */
     basic_storage(basic_storage &&other) noexcept
         : base_type{static_cast<base_type &&>(other)},
-          payload{std::move(other.payload)} {}
+          arena{std::move(other.arena)},
+          ranges{std::move(other.ranges)},
+          used{std::exchange(other.used, 0u)} {}
 
     /**
      * @brief Allocator-extended move constructor.
@@ -451,15 +3140,14 @@ public:
      */
     basic_storage(basic_storage &&other, const allocator_type &allocator)
         : base_type{static_cast<base_type &&>(other), allocator},
-          payload{std::move(other.payload), allocator} {
+          arena{std::move(other.arena), allocator},
+          ranges{std::move(other.ranges), allocator},
+          used{std::exchange(other.used, 0u)} {
         ENTT_ASSERT(alloc_traits::is_always_equal::value || get_allocator() == other.get_allocator(), "Copying a storage is not allowed");
     }
 
     /*! @brief Default destructor. */
-    // NOLINTNEXTLINE(bugprone-exception-escape)
-    ~basic_storage() override {
-        shrink_to_size(0u);
-    }
+    ~basic_storage() override = default;
 
     /**
      * @brief Default copy assignment operator, deleted on purpose.
@@ -484,7 +3172,9 @@ public:
      */
     void swap(basic_storage &other) noexcept {
         using std::swap;
-        swap(payload, other.payload);
+        swap(arena, other.arena);
+        swap(ranges, other.ranges);
+        swap(used, other.used);
         base_type::swap(other);
     }
 
@@ -493,50 +3183,37 @@ public:
      * @return The associated allocator.
      */
     [[nodiscard]] constexpr allocator_type get_allocator() const noexcept {
-        return payload.get_allocator();
+        return allocator_type{arena.get_allocator()};
     }
 
     /**
      * @brief Increases the capacity of a storage.
      *
      * If the new capacity is greater than the current capacity, new storage is
-     * allocated, otherwise the method does nothing.
+     * allocated, otherwise the method does nothing. Only the room for the
+     * sequences is reserved, not the one for their elements.
      *
      * @param cap Desired capacity.
      */
     void reserve(const size_type cap) override {
-        if(cap != 0u) {
-            base_type::reserve(cap);
-            assure_at_least(cap - 1u);
-        }
+        base_type::reserve(cap);
+        ranges.reserve(cap);
     }
 
     /**
-     * @brief Returns the number of elements that a storage has currently
+     * @brief Returns the number of sequences that a storage has currently
      * allocated space for.
      * @return Capacity of the storage.
      */
     [[nodiscard]] size_type capacity() const noexcept override {
-        return payload.size() * traits_type::page_size;
+        return ranges.capacity();
     }
 
-    /*! @brief Requests the removal of unused capacity. */
+    /*! @brief Requests the removal of unused capacity and compacts the arena. */
     void shrink_to_fit() override {
         base_type::shrink_to_fit();
-        shrink_to_size(base_type::size());
-    }
-
-    /**
-     * @brief Direct access to the array of objects.
-     * @return A pointer to the array of objects.
-     */
-    [[nodiscard]] const_pointer raw() const noexcept {
-        return payload.data();
-    }
-
-    /*! @copydoc raw */
-    [[nodiscard]] pointer raw() noexcept {
-        return payload.data();
+        compact_arena();
+        ranges.shrink_to_fit();
     }
 
     /**
@@ -548,7 +3225,7 @@ public:
      */
     [[nodiscard]] const_iterator cbegin() const noexcept {
         const auto pos = static_cast<difference_type>(base_type::size());
-        return const_iterator{&payload, pos};
+        return const_iterator{&arena, &ranges, pos};
     }
 
     /*! @copydoc cbegin */
@@ -559,7 +3236,7 @@ public:
     /*! @copydoc begin */
     [[nodiscard]] iterator begin() noexcept {
         const auto pos = static_cast<difference_type>(base_type::size());
-        return iterator{&payload, pos};
+        return iterator{&arena, &ranges, pos};
     }
 
     /**
@@ -568,7 +3245,7 @@ public:
      * internal array.
      */
     [[nodiscard]] const_iterator cend() const noexcept {
-        return const_iterator{&payload, {}};
+        return const_iterator{&arena, &ranges, {}};
     }
 
     /*! @copydoc cend */
@@ -578,7 +3255,7 @@ public:
 
     /*! @copydoc end */
     [[nodiscard]] iterator end() noexcept {
-        return iterator{&payload, {}};
+        return iterator{&arena, &ranges, {}};
     }
 
     /**
@@ -622,79 +3299,73 @@ public:
     }
 
     /**
-     * @brief Returns the object assigned to an entity.
+     * @brief Returns the sequence assigned to an entity.
      *
      * @warning
      * Attempting to use an entity that doesn't belong to the storage results in
      * undefined behavior.
      *
      * @param entt A valid identifier.
-     * @return The object assigned to the entity.
+     * @return The sequence assigned to the entity.
      */
-    [[nodiscard]] const value_type &get(const entity_type entt) const noexcept {
-        return element_at(base_type::index(entt));
+    [[nodiscard]] const_reference get(const entity_type entt) const noexcept {
+        const auto &elem = ranges[base_type::index(entt)];
+        return const_reference{arena.data() + elem.offset, elem.length};
     }
 
     /*! @copydoc get */
-    [[nodiscard]] value_type &get(const entity_type entt) noexcept {
-        return const_cast<value_type &>(std::as_const(*this).get(entt));
+    [[nodiscard]] reference get(const entity_type entt) noexcept {
+        const auto &elem = ranges[base_type::index(entt)];
+        return reference{arena.data() + elem.offset, elem.length};
     }
 
     /**
-     * @brief Returns the object assigned to an entity as a tuple.
+     * @brief Returns the sequence assigned to an entity as a tuple.
      * @param entt A valid identifier.
-     * @return The object assigned to the entity as a tuple.
+     * @return The sequence assigned to the entity as a tuple.
      */
-    [[nodiscard]] std::tuple<const value_type &> get_as_tuple(const entity_type entt) const noexcept {
-        return std::forward_as_tuple(get(entt));
+    [[nodiscard]] std::tuple<const_reference> get_as_tuple(const entity_type entt) const noexcept {
+        return std::make_tuple(get(entt));
     }
 
     /*! @copydoc get_as_tuple */
-    [[nodiscard]] std::tuple<value_type &> get_as_tuple(const entity_type entt) noexcept {
-        return std::forward_as_tuple(get(entt));
+    [[nodiscard]] std::tuple<reference> get_as_tuple(const entity_type entt) noexcept {
+        return std::make_tuple(get(entt));
     }
 
     /**
-     * @brief Assigns an entity to a storage and constructs its object.
+     * @brief Assigns an entity to a storage and copies a sequence of elements.
      *
      * @warning
      * Attempting to use an entity that already belongs to the storage results
      * in undefined behavior.
      *
-     * @tparam Args Types of arguments to use to construct the object.
      * @param entt A valid identifier.
-     * @param args Parameters to use to construct an object for the entity.
-     * @return A reference to the newly created object.
+     * @param value The sequence of elements to copy, if any.
+     * @return The sequence assigned to the entity.
      */
-    template<typename... Args>
-    value_type &emplace(const entity_type entt, Args &&...args) {
-        if constexpr(std::is_aggregate_v<value_type> && (sizeof...(Args) != 0u || !std::is_default_constructible_v<value_type>)) {
-            const auto it = emplace_element(entt, false, Type{std::forward<Args>(args)...});
-            return element_at(static_cast<size_type>(it.index()));
-        } else {
-            const auto it = emplace_element(entt, false, std::forward<Args>(args)...);
-            return element_at(static_cast<size_type>(it.index()));
-        }
+    reference emplace(const entity_type entt, const value_type value = {}) {
+        emplace_element(entt, false, value);
+        return get(entt);
     }
 
     /**
-     * @brief Updates the instance assigned to a given entity in-place.
+     * @brief Updates the sequence assigned to a given entity in-place.
      * @tparam Func Types of the function objects to invoke.
      * @param entt A valid identifier.
      * @param func Valid function objects.
-     * @return A reference to the updated instance.
+     * @return The updated sequence.
      */
     template<typename... Func>
-    value_type &patch(const entity_type entt, Func &&...func) {
-        const auto idx = base_type::index(entt);
-        auto &elem = element_at(idx);
+    reference patch(const entity_type entt, Func &&...func) {
+        auto elem = get(entt);
         (std::forward<Func>(func)(elem), ...);
         return elem;
     }
 
     /**
-     * @brief Assigns one or more entities to a storage and constructs their
-     * objects from a given instance.
+     * @brief Assigns one or more entities to a storage and copies the same
+     * sequence of elements to all of them.
      *
      * @warning
      * Attempting to assign an entity that already belongs to the storage
@@ -702,10 +3373,10 @@ public:
      *
      * @param first An iterator to the first element of the range of entities.
      * @param last An iterator past the last element of the range of entities.
-     * @param value An instance of the object to construct.
+     * @param value The sequence of elements to copy, if any.
      * @return Iterator pointing to the first element inserted, if any.
      */
-    iterator insert(stl::input_iterator auto first, stl::input_iterator auto last, const value_type &value = {}) {
+    iterator insert(stl::input_iterator auto first, stl::input_iterator auto last, const value_type value = {}) {
         for(; first != last; ++first) {
             emplace_element(*first, true, value);
         }
@@ -713,33 +3384,11 @@ public:
         return begin();
     }
 
-    /**
-     * @brief Assigns one or more entities to a storage and constructs their
-     * objects from a given range.
-     *
-     * @sa construct
-     *
-     * @tparam It Type of input iterator.
-     * @param first An iterator to the first element of the range of entities.
-     * @param last An iterator past the last element of the range of entities.
-     * @param from An iterator to the first element of the range of objects.
-     * @return Iterator pointing to the first element inserted, if any.
-     */
-    template<stl::input_iterator It>
-    requires std::same_as<typename std::iterator_traits<It>::value_type, value_type>
-    iterator insert(stl::input_iterator auto first, stl::input_iterator auto last, It from) {
-        for(; first != last; ++first, ++from) {
-            emplace_element(*first, true, *from);
-        }
-
-        return begin();
-    }
-
     /**
      * @brief Returns an iterable object to use to _visit_ a storage.
      *
      * The iterable object returns a tuple that contains the current entity and
-     * a reference to its element.
+     * its sequence of elements.
      *
      * @return An iterable object to use to _visit_ the storage.
      */
@@ -769,186 +3418,9 @@ public:
     }
 
 private:
-    container_type payload;
-};
-
-/*! @copydoc basic_storage */
-template<typename Type, typename Entity, typename Allocator>
-requires (component_traits<Type, Entity>::page_size == 0u)
-class basic_storage<Type, Entity, Allocator>
-    : public basic_sparse_set<Entity, typename std::allocator_traits<Allocator>::template rebind_alloc<Entity>> {
-    using alloc_traits = std::allocator_traits<Allocator>;
-    static_assert(std::is_same_v<typename alloc_traits::value_type, Type>, "Invalid value type");
-    using traits_type = component_traits<Type, Entity>;
-
-public:
-    /*! @brief Allocator type. */
-    using allocator_type = Allocator;
-    /*! @brief Base type. */
-    using base_type = basic_sparse_set<Entity, typename alloc_traits::template rebind_alloc<Entity>>;
-    /*! @brief Element type. */
-    using element_type = Type;
-    /*! @brief Type of the objects assigned to entities. */
-    using value_type = void;
-    /*! @brief Underlying entity identifier. */
-    using entity_type = Entity;
-    /*! @brief Unsigned integer type. */
-    using size_type = std::size_t;
-    /*! @brief Signed integer type. */
-    using difference_type = std::ptrdiff_t;
-    /*! @brief Extended iterable storage proxy. */
-    using iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::iterator>>;
-    /*! @brief Constant extended iterable storage proxy. */
-    using const_iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::const_iterator>>;
-    /*! @brief Extended reverse iterable storage proxy. */
-    using reverse_iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::reverse_iterator>>;
-    /*! @brief Constant extended reverse iterable storage proxy. */
-    using const_reverse_iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::const_reverse_iterator>>;
-    /*! @brief Storage deletion policy. */
-    static constexpr deletion_policy storage_policy{traits_type::in_place_delete};
-
-    /*! @brief Default constructor. */
-    basic_storage()
-        : basic_storage{allocator_type{}} {}
-
-    /**
-     * @brief Constructs an empty container with a given allocator.
-     * @param allocator The allocator to use.
-     */
-    explicit basic_storage(const allocator_type &allocator)
-        : base_type{type_id<element_type>(), storage_policy, allocator} {}
-
-    /*! @brief Default copy constructor, deleted on purpose. */
-    basic_storage(const basic_storage &) = delete;
-
-    /**
-     * @brief Move constructor.
-     * @param other The instance to move from.
-     */
-    basic_storage(basic_storage &&other) noexcept = default;
-
-    /**
-     * @brief Allocator-extended move constructor.
-     * @param other The instance to move from.
-     * @param allocator The allocator to use.
-     */
-    basic_storage(basic_storage &&other, const allocator_type &allocator)
-        : base_type{std::move(other), allocator} {}
-
-    /*! @brief Default destructor. */
-    ~basic_storage() override = default;
-
-    /**
-     * @brief Default copy assignment operator, deleted on purpose.
-     * @return This storage.
-     */
-    basic_storage &operator=(const basic_storage &) = delete;
-
-    /**
-     * @brief Move assignment operator.
-     * @param other The instance to move from.
-     * @return This storage.
-     */
-    basic_storage &operator=(basic_storage &&other) noexcept = default;
-
-    /**
-     * @brief Returns the associated allocator.
-     * @return The associated allocator.
-     */
-    [[nodiscard]] constexpr allocator_type get_allocator() const noexcept {
-        return allocator_type{base_type::get_allocator()};
-    }
-
-    /**
-     * @brief Returns the object assigned to an entity, that is `void`.
-     *
-     * @warning
-     * Attempting to use an entity that doesn't belong to the storage results in
-     * undefined behavior.
-     *
-     * @param entt A valid identifier.
-     */
-    void get([[maybe_unused]] const entity_type entt) const noexcept {
-        ENTT_ASSERT(base_type::contains(entt), "Invalid entity");
-    }
-
-    /**
-     * @brief Returns an empty tuple.
-     * @param entt A valid identifier.
-     * @return Returns an empty tuple.
-     */
-    [[nodiscard]] std::tuple<> get_as_tuple([[maybe_unused]] const entity_type entt) const noexcept {
-        ENTT_ASSERT(base_type::contains(entt), "Invalid entity");
-        return std::tuple{};
-    }
-
-    /**
-     * @brief Assigns an entity to a storage and constructs its object.
-     *
-     * @warning
-     * Attempting to use an entity that already belongs to the storage results
-     * in undefined behavior.
-     *
-     * @param entt A valid identifier.
-     */
-    void emplace(const entity_type entt, const auto &...) {
-        base_type::try_emplace(entt, false);
-    }
-
-    /**
-     * @brief Updates the instance assigned to a given entity in-place.
-     * @tparam Func Types of the function objects to invoke.
-     * @param entt A valid identifier.
-     * @param func Valid function objects.
-     */
-    template<typename... Func>
-    void patch([[maybe_unused]] const entity_type entt, Func &&...func) {
-        ENTT_ASSERT(base_type::contains(entt), "Invalid entity");
-        (std::forward<Func>(func)(), ...);
-    }
-
-    /**
-     * @brief Assigns entities to a storage.
-     * @param first An iterator to the first element of the range of entities.
-     * @param last An iterator past the last element of the range of entities.
-     */
-    void insert(stl::input_iterator auto first, stl::input_iterator auto last, const auto &...) {
-        for(; first != last; ++first) {
-            base_type::try_emplace(*first, true);
-        }
-    }
-
-    /**
-     * @brief Returns an iterable object to use to _visit_ a storage.
-     *
-     * The iterable object returns a tuple that contains the current entity.
-     *
-     * @return An iterable object to use to _visit_ the storage.
-     */
-    [[nodiscard]] iterable each() noexcept {
-        return iterable{base_type::begin(), base_type::end()};
-    }
-
-    /*! @copydoc each */
-    [[nodiscard]] const_iterable each() const noexcept {
-        return const_iterable{base_type::cbegin(), base_type::cend()};
-    }
-
-    /**
-     * @brief Returns a reverse iterable object to use to _visit_ a storage.
-     *
-     * @sa each
-     *
-     * @return A reverse iterable object to use to _visit_ the storage.
-     */
-    [[nodiscard]] reverse_iterable reach() noexcept {
-        return reverse_iterable{{base_type::rbegin()}, {base_type::rend()}};
-    }
-
-    /*! @copydoc reach */
-    [[nodiscard]] const_reverse_iterable reach() const noexcept {
-        return const_reverse_iterable{{base_type::crbegin()}, {base_type::crend()}};
-    }
+    arena_type arena;
+    ranges_type ranges;
+    size_type used{};
 };
 
 /**
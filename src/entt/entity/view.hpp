@@ -1,17 +1,24 @@
 #ifndef ENTT_ENTITY_VIEW_HPP
 #define ENTT_ENTITY_VIEW_HPP
 
+#include <algorithm>
 #include <array>
 #include <concepts>
 #include <cstddef>
+#include <cstdint>
 #include <iterator>
+#include <limits>
+#include <memory>
+#include <span>
 #include <tuple>
 #include <type_traits>
 #include <utility>
 #include "../config/config.h"
 #include "../core/concepts.hpp"
 #include "../core/iterator.hpp"
+#include "../core/memory.hpp"
 #include "../core/type_traits.hpp"
+#include "component.hpp"
 #include "entity.hpp"
 #include "fwd.hpp"
 
@@ -46,6 +53,43 @@ template<typename It>
     return first == last;
 }
 
+template<typename Type>
+struct prefetch_distance_of: std::integral_constant<std::size_t, 0u> {};
+
+template<typename Type>
+requires std::is_convertible_v<decltype(component_traits<std::remove_const_t<typename Type::element_type>, typename Type::entity_type>::prefetch_distance), std::size_t>
+struct prefetch_distance_of<Type>: std::integral_constant<std::size_t, component_traits<std::remove_const_t<typename Type::element_type>, typename Type::entity_type>::prefetch_distance> {};
+
+template<typename Type>
+void prefetch_element([[maybe_unused]] const Type &cpool, [[maybe_unused]] const typename Type::entity_type entt) noexcept {
+    // only storage with arrays of elements, proxies aren't worth it
+    if constexpr(!std::is_void_v<typename Type::value_type> && std::is_lvalue_reference_v<decltype(cpool.rbegin()[0])>) {
+        if(cpool.contains(entt)) {
+            ENTT_PREFETCH(std::addressof(cpool.rbegin()[static_cast<typename Type::difference_type>(cpool.index(entt))]));
+        }
+    }
+}
+
+template<typename Executor, typename Iterable, typename Func>
+void parallel_each(Executor &jobs, const Iterable &iterable, Func func) {
+    constexpr std::size_t page_size = ENTT_PACKED_PAGE;
+    const auto first = iterable.begin();
+    const auto length = static_cast<std::size_t>(iterable.end().base() - first.base());
+
+    jobs.parallel_for((length + page_size - 1u) / page_size, [&first, &func, length](const std::size_t chunk) {
+        const auto from = chunk * page_size;
+        const auto to = (length - from) < page_size ? length : (from + page_size);
+        auto it = first;
+
+        // iterables visit the packed array backwards, chunks are page aligned
+        it += static_cast<std::ptrdiff_t>(length - to);
+
+        for(auto count = to - from; count != 0u; --count, ++it) {
+            func(*it);
+        }
+    });
+}
+
 template<typename Result, typename View, typename Other, std::size_t... GLhs, std::size_t... ELhs, std::size_t... GRhs, std::size_t... ERhs>
 [[nodiscard]] Result view_pack(const View &view, const Other &other, std::index_sequence<GLhs...>, std::index_sequence<ELhs...>, std::index_sequence<GRhs...>, std::index_sequence<ERhs...>) {
     Result elem{};
@@ -71,8 +115,25 @@ class view_iterator final {
                && ((Exclude == 0u) || internal::none_of(filter.begin(), filter.end(), entt));
     }
 
+    void prefetch() const noexcept {
+        // entities are visited backwards, look ahead means towards the front
+        if(const auto pos = it.index() - distance; (distance != 0) && (pos >= 0)) {
+            const auto entt = it.data()[pos];
+
+            for(difference_type next{}; next < static_cast<difference_type>(Get); ++next) {
+                if(next != index) {
+                    pools[next]->prefetch(entt);
+                }
+            }
+
+            for(auto *elem: filter) {
+                elem->prefetch(entt);
+            }
+        }
+    }
+
     void seek_next() {
-        for(constexpr iterator_type sentinel{}; it != sentinel && !valid(*it); ++it) {}
+        for(constexpr iterator_type sentinel{}; it != sentinel && (prefetch(), !valid(*it)); ++it) {}
     }
 
 public:
@@ -86,13 +147,15 @@ public:
         : it{},
           pools{},
           filter{},
-          index{} {}
+          index{},
+          distance{} {}
 
-    view_iterator(iterator_type first, std::array<const Type *, Get> value, std::array<const Type *, Exclude> excl, const std::size_t idx) noexcept
+    view_iterator(iterator_type first, std::array<const Type *, Get> value, std::array<const Type *, Exclude> excl, const std::size_t idx, const std::size_t ahead = 0u) noexcept
         : it{first},
           pools{value},
           filter{excl},
-          index{static_cast<difference_type>(idx)} {
+          index{static_cast<difference_type>(idx)},
+          distance{static_cast<difference_type>(ahead)} {
         ENTT_ASSERT((Get != 1u) || (Exclude != 0u) || pools[0u]->policy() == deletion_policy::in_place, "Non in-place storage view iterator");
         seek_next();
     }
@@ -126,6 +189,7 @@ private:
     std::array<const Type *, Get> pools;
     std::array<const Type *, Exclude> filter;
     difference_type index;
+    difference_type distance;
 };
 
 template<typename It, typename... Get>
@@ -145,7 +209,16 @@ struct extended_view_iterator final {
         : it{from} {}
 
     extended_view_iterator &operator++() noexcept {
-        return ++it, *this;
+        ++it;
+
+        // halfway, the slots of the sparse arrays were requested a while ago
+        if(const auto pos = it.it.index() - it.distance / 2; (it.distance > 1) && (pos >= 0)) {
+            [this, entt = it.it.data()[pos]]<auto... Index>(std::index_sequence<Index...>) {
+                (((static_cast<decltype(it.index)>(Index) != it.index) ? prefetch_element(*static_cast<const Get *>(std::get<Index>(it.pools)), entt) : void()), ...);
+            }(std::index_sequence_for<Get...>{});
+        }
+
+        return *this;
     }
 
     extended_view_iterator operator++(int) noexcept {
@@ -176,6 +249,216 @@ private:
     It it;
 };
 
+template<typename>
+struct is_blob: std::false_type {};
+
+template<typename Type>
+struct is_blob<blob_t<Type>>: std::true_type {};
+
+template<typename Type>
+static constexpr std::size_t page_size_of_v = component_traits<std::remove_const_t<typename Type::element_type>, typename Type::entity_type>::page_size;
+
+template<typename Type>
+static constexpr std::size_t chunk_page_v = (page_size_of_v<Type> == 0u) ? (std::numeric_limits<std::size_t>::max)() : page_size_of_v<Type>;
+
+template<typename Type, auto... Member>
+[[nodiscard]] auto chunk_span(Type &cpool, const std::size_t first, const std::size_t length, value_list<Member...>) {
+    const auto page = first / page_size_of_v<Type>;
+    const auto offset = fast_mod(first, page_size_of_v<Type>);
+    return std::make_tuple(std::span<std::remove_reference_t<decltype(cpool.rbegin()[0].template get<Member>())>>{cpool.template raw<Member>()[page] + offset, length}...);
+}
+
+template<typename Type>
+[[nodiscard]] auto chunk_span([[maybe_unused]] Type &cpool, [[maybe_unused]] const std::size_t first, [[maybe_unused]] const std::size_t length) {
+    if constexpr(std::is_void_v<typename Type::value_type> || is_blob<std::remove_const_t<typename Type::element_type>>::value) {
+        // neither empty types nor blobs have an array of elements to split
+        return std::make_tuple();
+    } else if constexpr(!std::is_lvalue_reference_v<decltype(cpool.rbegin()[0])>) {
+        // column storage, one span for each data member
+        using columns_type = component_traits<std::remove_const_t<typename Type::element_type>, typename Type::entity_type>::columns;
+        return std::make_tuple(chunk_span(cpool, first, length, columns_type{}));
+    } else {
+        using element_type = std::remove_reference_t<decltype(cpool.rbegin()[0])>;
+        return std::make_tuple(std::span<element_type>{&cpool.rbegin()[static_cast<typename Type::difference_type>(first)], length});
+    }
+}
+
+template<typename Entity, typename... Type>
+class chunk_iterator final {
+    static constexpr auto page_size = (std::min)({chunk_page_v<Type>...});
+
+    [[nodiscard]] static std::size_t per_page(const std::size_t step) noexcept {
+        return page_size / step + static_cast<std::size_t>(page_size % step != 0u);
+    }
+
+public:
+    using value_type = decltype(std::tuple_cat(std::make_tuple(std::span<const Entity>{}), chunk_span(std::declval<Type &>(), 0u, 0u)...));
+    using pointer = input_iterator_pointer<value_type>;
+    using reference = value_type;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::input_iterator_tag;
+    using iterator_concept = std::forward_iterator_tag;
+
+    [[nodiscard]] static std::size_t count(const std::size_t length, const std::size_t step) noexcept {
+        const auto rem = length % page_size;
+        return (length / page_size) * per_page(step) + rem / step + static_cast<std::size_t>(rem % step != 0u);
+    }
+
+    [[nodiscard]] static std::pair<std::size_t, std::size_t> range(const std::size_t pos, const std::size_t length, const std::size_t step) noexcept {
+        const auto chunks = per_page(step);
+        const auto page = (pos / chunks) * page_size;
+        const auto first = page + (pos % chunks) * step;
+        return {first, (std::min)({first + step, page + page_size, length})};
+    }
+
+    constexpr chunk_iterator()
+        : pools{},
+          pos{},
+          length{},
+          step{} {}
+
+    chunk_iterator(std::tuple<Type *...> cpools, const std::size_t from, const std::size_t len, const std::size_t chunk) noexcept
+        : pools{std::move(cpools)},
+          pos{from},
+          length{len},
+          step{chunk} {}
+
+    chunk_iterator &operator++() noexcept {
+        return ++pos, *this;
+    }
+
+    chunk_iterator operator++(int) noexcept {
+        const chunk_iterator orig = *this;
+        return ++(*this), orig;
+    }
+
+    [[nodiscard]] reference operator*() const noexcept {
+        const auto [first, last] = range(pos, length, step);
+        const auto *data = std::get<0>(pools)->data();
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        return std::tuple_cat(std::make_tuple(std::span<const Entity>{data + first, last - first}), chunk_span(*std::get<Type *>(pools), first, last - first)...);
+    }
+
+    [[nodiscard]] pointer operator->() const noexcept {
+        return operator*();
+    }
+
+    [[nodiscard]] constexpr bool operator==(const chunk_iterator &other) const noexcept {
+        return pos == other.pos;
+    }
+
+private:
+    std::tuple<Type *...> pools;
+    std::size_t pos;
+    std::size_t length;
+    std::size_t step;
+};
+
+template<typename Type, std::size_t Exclude, typename... Get>
+class view_chunk_iterator final {
+    using entity_type = Type::entity_type;
+
+    static constexpr std::array<std::size_t, sizeof...(Get)> page_size{chunk_page_v<Get>...};
+
+    [[nodiscard]] bool valid(const entity_type entt) const noexcept {
+        std::size_t pos{};
+        for(; pos < Exclude && (filter[pos] == nullptr || !filter[pos]->contains(entt)); ++pos) {}
+        return (entt != tombstone) && internal::all_of(pools.begin(), pools.end(), entt) && (pos == Exclude);
+    }
+
+    [[nodiscard]] bool aligned(const entity_type entt, const std::size_t dist) const noexcept {
+        std::size_t pos{};
+        for(; pos < pools.size() && (pools[pos]->index(entt) == (offset[pos] + dist)); ++pos) {}
+        return pos == pools.size();
+    }
+
+    void seek_next() {
+        const auto *data = lead->data();
+
+        for(; first != length && !valid(data[first]); ++first) {}
+
+        last = first;
+
+        if(first != length) {
+            auto limit = (std::min)(step, length - first);
+
+            for(std::size_t pos{}; pos < pools.size(); ++pos) {
+                offset[pos] = pools[pos]->index(data[first]);
+                limit = (std::min)(limit, page_size[pos] - offset[pos] % page_size[pos]);
+            }
+
+            // runs end where storage stop being sorted the same way or at page boundaries
+            for(++last; (last - first) < limit && valid(data[last]) && aligned(data[last], last - first); ++last) {}
+        }
+    }
+
+public:
+    using value_type = decltype(std::tuple_cat(std::make_tuple(std::span<const entity_type>{}), chunk_span(std::declval<Get &>(), 0u, 0u)...));
+    using pointer = input_iterator_pointer<value_type>;
+    using reference = value_type;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::input_iterator_tag;
+    using iterator_concept = std::forward_iterator_tag;
+
+    constexpr view_chunk_iterator() noexcept
+        : lead{},
+          pools{},
+          filter{},
+          offset{},
+          first{},
+          last{},
+          length{},
+          step{} {}
+
+    view_chunk_iterator(const Type *leading, std::array<const Type *, sizeof...(Get)> value, std::array<const Type *, Exclude> excl, const std::size_t from, const std::size_t len, const std::size_t chunk) noexcept
+        : lead{leading},
+          pools{value},
+          filter{excl},
+          offset{},
+          first{from},
+          last{},
+          length{len},
+          step{chunk} {
+        seek_next();
+    }
+
+    view_chunk_iterator &operator++() noexcept {
+        first = last;
+        seek_next();
+        return *this;
+    }
+
+    view_chunk_iterator operator++(int) noexcept {
+        const view_chunk_iterator orig = *this;
+        return ++(*this), orig;
+    }
+
+    [[nodiscard]] reference operator*() const noexcept {
+        return [this]<auto... Index>(std::index_sequence<Index...>) {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            return std::tuple_cat(std::make_tuple(std::span<const entity_type>{lead->data() + first, last - first}), chunk_span(*static_cast<Get *>(const_cast<constness_as_t<typename Get::base_type, Get> *>(pools[Index])), offset[Index], last - first)...);
+        }(std::index_sequence_for<Get...>{});
+    }
+
+    [[nodiscard]] pointer operator->() const noexcept {
+        return operator*();
+    }
+
+    [[nodiscard]] constexpr bool operator==(const view_chunk_iterator &other) const noexcept {
+        return first == other.first;
+    }
+
+private:
+    const Type *lead;
+    std::array<const Type *, sizeof...(Get)> pools;
+    std::array<const Type *, Exclude> filter;
+    std::array<std::size_t, sizeof...(Get)> offset;
+    std::size_t first;
+    std::size_t last;
+    std::size_t length;
+    std::size_t step;
+};
+
 } // namespace internal
 /*! @endcond */
 
@@ -232,16 +515,18 @@ class basic_common_view {
 
 protected:
     /*! @cond ENTT_INTERNAL */
-    basic_common_view() noexcept {
+    basic_common_view(const std::size_t ahead = 0u) noexcept
+        : distance{ahead} {
         for(size_type pos{}, last = filter.size(); pos < last; ++pos) {
             filter[pos] = placeholder;
         }
     }
 
-    basic_common_view(std::array<const Type *, Get> value, std::array<const Type *, Exclude> excl) noexcept
+    basic_common_view(std::array<const Type *, Get> value, std::array<const Type *, Exclude> excl, const std::size_t ahead = 0u) noexcept
         : pools{value},
           filter{excl},
-          index{Get} {
+          index{Get},
+          distance{ahead} {
         unchecked_refresh();
     }
 
@@ -264,13 +549,27 @@ protected:
         filter[pos] = elem;
     }
 
-    [[nodiscard]] bool none_of(const Type::entity_type entt) const noexcept {
-        return internal::none_of(filter.begin(), filter.end(), entt);
+    void prefetch(const Type::entity_type *entt, const std::size_t len, const std::size_t skip) const noexcept {
+        for(size_type next{}; next < Get; ++next) {
+            if(next != skip) {
+                for(size_type pos{}; pos < len; ++pos) {
+                    pools[next]->prefetch(entt[pos]);
+                }
+            }
+        }
+
+        for(size_type next{}; next < Exclude; ++next) {
+            for(size_type pos{}; pos < len; ++pos) {
+                filter[next]->prefetch(entt[pos]);
+            }
+        }
     }
 
     void use(const std::size_t pos) noexcept {
         index = (index != Get) ? pos : Get;
     }
+
+    static constexpr std::size_t block_size = 16u;
     /*! @endcond */
 
 public:
@@ -303,6 +602,29 @@ public:
         return (index != Get) ? pools[index] : nullptr;
     }
 
+    /**
+     * @brief Returns the number of entities the view looks ahead.
+     * @return The number of entities the view looks ahead, zero if disabled.
+     */
+    [[nodiscard]] size_type prefetch_distance() const noexcept {
+        return distance;
+    }
+
+    /**
+     * @brief Sets the number of entities the view looks ahead.
+     *
+     * While visiting an entity, the view prefetches what is needed to test and
+     * access the entities that follow it at the given distance in all storage
+     * but the leading one.<br/>
+     * Prefetching is disabled when the distance is zero. The default value is
+     * the largest `prefetch_distance` of the elements of the view.
+     *
+     * @param value The number of entities to look ahead.
+     */
+    void prefetch_distance(const size_type value) noexcept {
+        distance = value;
+    }
+
     /**
      * @brief Estimates the number of entities iterated by the view.
      * @return Estimated number of entities iterated by the view.
@@ -319,7 +641,7 @@ public:
      * @return An iterator to the first entity of the view.
      */
     [[nodiscard]] iterator begin() const noexcept {
-        return (index != Get) ? iterator{pools[index]->end() - static_cast<difference_type>(offset()), pools, filter, index} : iterator{};
+        return (index != Get) ? iterator{pools[index]->end() - static_cast<difference_type>(offset()), pools, filter, index, distance} : iterator{};
     }
 
     /**
@@ -327,7 +649,7 @@ public:
      * @return An iterator to the entity following the last entity of the view.
      */
     [[nodiscard]] iterator end() const noexcept {
-        return (index != Get) ? iterator{pools[index]->end(), pools, filter, index} : iterator{};
+        return (index != Get) ? iterator{pools[index]->end(), pools, filter, index, distance} : iterator{};
     }
 
     /**
@@ -363,7 +685,7 @@ public:
      * iterator otherwise.
      */
     [[nodiscard]] iterator find(const entity_type entt) const noexcept {
-        return contains(entt) ? iterator{pools[index]->find(entt), pools, filter, index} : end();
+        return contains(entt) ? iterator{pools[index]->find(entt), pools, filter, index, distance} : end();
     }
 
     /**
@@ -391,6 +713,7 @@ private:
     std::array<const common_type *, Exclude> filter{};
     const common_type *placeholder{internal::view_placeholder<common_type>()};
     size_type index{Get};
+    size_type distance{};
 };
 
 /**
@@ -417,6 +740,8 @@ class basic_view<get_t<Get...>, exclude_t<Exclude...>>
     template<typename Type>
     static constexpr std::size_t index_of = type_list_index_v<std::remove_const_t<Type>, type_list<typename Get::element_type..., typename Exclude::element_type...>>;
 
+    static constexpr std::size_t prefetch_distance_v = (std::max)({std::size_t{}, internal::prefetch_distance_of<Get>::value..., internal::prefetch_distance_of<Exclude>::value...});
+
     template<std::size_t Curr, std::size_t Other, typename... Args>
     [[nodiscard]] auto dispatch_get(const std::tuple<typename base_type::entity_type, Args...> &curr) const {
         if constexpr(Curr == Other) {
@@ -426,19 +751,114 @@ class basic_view<get_t<Get...>, exclude_t<Exclude...>>
         }
     }
 
-    template<std::size_t Curr, typename Func, std::size_t... Index>
-    void each(Func func, std::index_sequence<Index...>) const {
-        for(const auto curr: storage<Curr>()->each()) {
-            if(const auto entt = std::get<0>(curr); (!internal::tombstone_check_v<Get...> || (entt != tombstone)) && ((Curr == Index || base_type::pool_at(Index)->contains(entt)) && ...) && base_type::none_of(entt)) {
-                if constexpr(is_applicable_v<Func, decltype(std::tuple_cat(std::tuple<entity_type>{}, std::declval<basic_view>().get({})))>) {
-                    std::apply(func, std::tuple_cat(std::make_tuple(entt), dispatch_get<Curr, Index>(curr)...));
+    template<std::size_t Curr, typename Func, typename Value, std::size_t... Index>
+    void invoke(Func &func, const Value &curr, std::index_sequence<Index...>) const {
+        if constexpr(is_applicable_v<Func, decltype(std::tuple_cat(std::tuple<entity_type>{}, std::declval<basic_view>().get({})))>) {
+            std::apply(func, std::tuple_cat(std::make_tuple(std::get<0>(curr)), dispatch_get<Curr, Index>(curr)...));
+        } else {
+            std::apply(func, std::tuple_cat(dispatch_get<Curr, Index>(curr)...));
+        }
+    }
+
+    // typed lookups, storage classes can answer faster than their base type
+    template<std::size_t Index>
+    [[nodiscard]] bool contains_at(const base_type::entity_type entt) const noexcept {
+        const auto *elem = storage<Index>();
+        return (Index < sizeof...(Get) || elem != nullptr) && elem->contains(entt);
+    }
+
+    template<std::size_t... Index>
+    [[nodiscard]] bool none_of(const base_type::entity_type entt, std::index_sequence<Index...>) const noexcept {
+        return !(contains_at<sizeof...(Get) + Index>(entt) || ...);
+    }
+
+    template<std::size_t Index>
+    void block_filter(std::uint32_t &mask, const base_type::entity_type *entt, const std::size_t len) const noexcept {
+        if(const auto *elem = storage<Index>(); mask != 0u && elem != nullptr) {
+            for(std::size_t pos{}; pos < len; ++pos) {
+                if constexpr(Index < sizeof...(Get)) {
+                    mask &= ~(static_cast<std::uint32_t>(!elem->contains(entt[pos])) << pos);
                 } else {
-                    std::apply(func, std::tuple_cat(dispatch_get<Curr, Index>(curr)...));
+                    mask &= ~(static_cast<std::uint32_t>(elem->contains(entt[pos])) << pos);
                 }
             }
         }
     }
 
+    template<std::size_t Curr, std::size_t... Index>
+    [[nodiscard]] std::uint32_t block_filter(const base_type::entity_type *entt, const std::size_t len, std::index_sequence<Index...>) const noexcept {
+        ENTT_ASSERT(len <= base_type::block_size, "Invalid block");
+        std::uint32_t mask{};
+
+        // one pool at a time and no early exits within a block, this favors
+        // the branch predictor and lets the compiler vectorize the lookups
+        for(std::size_t pos{}; pos < len; ++pos) {
+            mask |= static_cast<std::uint32_t>(!internal::tombstone_check_v<Get...> || (entt[pos] != tombstone)) << pos;
+        }
+
+        ((Curr == Index ? void() : block_filter<Index>(mask, entt, len)), ...);
+        return mask;
+    }
+
+    template<std::size_t Curr, typename Func, typename Value, std::size_t... Index>
+    void visit(Func &func, const Value &curr, std::index_sequence<Index...> seq) const {
+        if(const auto entt = std::get<0>(curr); (!internal::tombstone_check_v<Get...> || (entt != tombstone)) && ((Curr == Index || contains_at<Index>(entt)) && ...) && none_of(entt, std::index_sequence_for<Exclude...>{})) {
+            invoke<Curr>(func, curr, seq);
+        }
+    }
+
+    template<std::size_t Curr, std::size_t... Index>
+    void prefetch(const base_type::entity_type *packed, const std::size_t pos, const std::size_t len, std::index_sequence<Index...>) const noexcept {
+        const auto ahead = base_type::prefetch_distance();
+        const auto half = ahead / 2u;
+
+        if(const auto last = pos + len; last > ahead) {
+            const auto first = (pos > ahead) ? (pos - ahead) : std::size_t{};
+            base_type::prefetch(packed + first, last - ahead - first, Curr);
+        }
+
+        // halfway, the slots of the sparse arrays were requested a while ago
+        for(auto next = (pos > half) ? (pos - half) : std::size_t{}, last = pos + len; half != 0u && (next + half) < last; ++next) {
+            ((Curr == Index ? void() : internal::prefetch_element(*storage<Index>(), packed[next])), ...);
+        }
+    }
+
+    template<std::size_t Curr, typename Func, std::size_t... Index>
+    void each(Func func, std::index_sequence<Index...> seq) const {
+        if constexpr((sizeof...(Get) + sizeof...(Exclude)) == 1u) {
+            for(const auto curr: storage<Curr>()->each()) {
+                visit<Curr>(func, curr, seq);
+            }
+        } else {
+            // entities are filtered in blocks, the resulting mask drives the iteration
+            const auto range = storage<Curr>()->each();
+            auto it = range.begin();
+
+            for(auto pos = static_cast<std::size_t>(range.end().base() - it.base()); pos != 0u;) {
+                const auto len = (pos < base_type::block_size) ? pos : base_type::block_size;
+                // callbacks can grow the pool and reallocate its packed array
+                const auto *packed = storage<Curr>()->data();
+                pos -= len;
+
+                if(base_type::prefetch_distance() != 0u) {
+                    prefetch<Curr>(packed, pos, len, seq);
+                }
+
+                // iterables visit the packed array backwards, so do masks
+                for(auto mask = block_filter<Curr>(packed + pos, len, std::index_sequence_for<Get..., Exclude...>{}), bit = std::uint32_t{1u} << (len - 1u); bit != 0u; bit >>= 1u, ++it) {
+                    if(mask & bit) {
+                        invoke<Curr>(func, *it, seq);
+                    }
+                }
+            }
+        }
+    }
+
+    template<std::size_t Curr, typename Executor, typename Func, std::size_t... Index>
+    void par_each(Executor &jobs, Func &func, std::index_sequence<Index...> seq) const {
+        internal::parallel_each(jobs, storage<Curr>()->each(), [this, &func, seq](const auto &curr) { visit<Curr>(func, curr, seq); });
+    }
+
     template<typename Type>
     void storage_if(Type *elem) noexcept {
         if(elem != nullptr) {
@@ -459,10 +879,12 @@ public:
     using iterator = base_type::iterator;
     /*! @brief Iterable view type. */
     using iterable = iterable_adaptor<internal::extended_view_iterator<iterator, Get...>>;
+    /*! @brief Iterable chunk type. */
+    using chunk_iterable = iterable_adaptor<internal::view_chunk_iterator<common_type, sizeof...(Exclude), Get...>>;
 
     /*! @brief Default constructor to use to create empty, invalid views. */
     basic_view() noexcept
-        : base_type{} {}
+        : base_type{prefetch_distance_v} {}
 
     /**
      * @brief Constructs a view from a set of storage classes.
@@ -470,7 +892,7 @@ public:
      * @param excl The storage for the types used to filter the view.
      */
     basic_view(Get &...value, Exclude &...excl) noexcept
-        : base_type{{&value...}, {&excl...}} {
+        : base_type{{&value...}, {&excl...}, prefetch_distance_v} {
     }
 
     /**
@@ -627,6 +1049,34 @@ public:
         }(std::index_sequence_for<Get...>{});
     }
 
+    /**
+     * @brief Iterates entities and elements in parallel and applies the given
+     * function object to them.
+     *
+     * The leading storage is split in page aligned chunks that are distributed
+     * among the threads of the executor. Any type that offers a `parallel_for`
+     * member function, such as a job system, is a valid executor.<br/>
+     * The signature of the function is the same as for `each`. However, the
+     * function is invoked concurrently from multiple threads and the order of
+     * the visit is unspecified.
+     *
+     * @warning
+     * Storage and entities must not be created or destroyed during iteration.
+     *
+     * @tparam Executor Type of executor to use to run the chunks.
+     * @tparam Func Type of the function object to invoke.
+     * @param jobs A valid executor.
+     * @param func A valid function object.
+     */
+    template<typename Executor, typename Func>
+    void par_each(Executor &jobs, Func func) const {
+        [this, &jobs, &func]<auto... Index>(std::index_sequence<Index...> seq) {
+            if(const auto *view = base_type::handle(); view != nullptr) {
+                ((view == base_type::pool_at(Index) ? par_each<Index>(jobs, func, seq) : void()), ...);
+            }
+        }(std::index_sequence_for<Get...>{});
+    }
+
     /**
      * @brief Returns an iterable object to use to _visit_ a view.
      *
@@ -640,6 +1090,38 @@ public:
         return iterable{base_type::begin(), base_type::end()};
     }
 
+    /**
+     * @brief Returns an iterable object to use to split a view in chunks.
+     *
+     * Each chunk is a tuple that contains a span of entities and a span of
+     * non-empty elements for each storage. All spans have the same size and
+     * refer to the same entities in the same order. The _constness_ of the
+     * elements is as requested. Column storages offer a tuple of spans instead,
+     * one for each data member.<br/>
+     * Chunks are runs of entities of the leading storage that are also sorted
+     * the same way in all other storage. They contain at most `length`
+     * entities and never cross a page of any storage. Therefore, the more the
+     * storage are sorted alike, the larger the chunks are. The set of entities
+     * visited is the same as with `each`, although in a different order.
+     *
+     * @param length The maximum number of entities per chunk.
+     * @return An iterable object to use to split the view in chunks.
+     */
+    [[nodiscard]] chunk_iterable chunks(const size_type length) const noexcept {
+        ENTT_ASSERT(length != 0u, "Invalid chunk size");
+
+        return [this, length]<auto... Index, auto... Other>(std::index_sequence<Index...>, std::index_sequence<Other...>) {
+            if(const auto *view = base_type::handle(); view != nullptr) {
+                const std::array<const common_type *, sizeof...(Get)> cpools{base_type::pool_at(Index)...};
+                const std::array<const common_type *, sizeof...(Exclude)> excl{base_type::filter_at(Other)...};
+                const auto last = base_type::size_hint();
+                return chunk_iterable{{view, cpools, excl, 0u, last, length}, {view, cpools, excl, last, last, length}};
+            }
+
+            return chunk_iterable{};
+        }(std::index_sequence_for<Get...>{}, std::index_sequence_for<Exclude...>{});
+    }
+
     /**
      * @brief Combines a view and a storage in _more specific_ view.
      * @tparam OGet Type of storage to combine the view with.
@@ -919,6 +1401,8 @@ public:
     using reverse_iterator = base_type::reverse_iterator;
     /*! @brief Iterable view type. */
     using iterable = std::conditional_t<Get::storage_policy == deletion_policy::in_place, iterable_adaptor<internal::extended_view_iterator<iterator, Get>>, decltype(std::declval<Get>().each())>;
+    /*! @brief Iterable chunk type. */
+    using chunk_iterable = iterable_adaptor<std::conditional_t<Get::storage_policy == deletion_policy::in_place, internal::view_chunk_iterator<common_type, 0u, Get>, internal::chunk_iterator<entity_type, Get>>>;
 
     /*! @brief Default constructor to use to create empty, invalid views. */
     basic_view() noexcept
@@ -1078,6 +1562,45 @@ public:
         }
     }
 
+    /**
+     * @brief Iterates entities and elements in parallel and applies the given
+     * function object to them.
+     *
+     * The underlying storage is split in page aligned chunks that are
+     * distributed among the threads of the executor. Any type that offers a
+     * `parallel_for` member function, such as a job system, is a valid
+     * executor.<br/>
+     * The signature of the function is the same as for `each`. However, the
+     * function is invoked concurrently from multiple threads and the order of
+     * the visit is unspecified.
+     *
+     * @warning
+     * Entities must not be created or destroyed during iteration.
+     *
+     * @tparam Executor Type of executor to use to run the chunks.
+     * @tparam Func Type of the function object to invoke.
+     * @param jobs A valid executor.
+     * @param func A valid function object.
+     */
+    template<typename Executor, typename Func>
+    void par_each(Executor &jobs, Func func) const {
+        if(base_type::handle() != nullptr) {
+            internal::parallel_each(jobs, storage()->each(), [&func](const auto &pack) {
+                if constexpr(Get::storage_policy == deletion_policy::in_place) {
+                    if(std::get<0>(pack) == tombstone) {
+                        return;
+                    }
+                }
+
+                if constexpr(is_applicable_v<Func, decltype(std::tuple_cat(std::tuple<entity_type>{}, std::declval<basic_view>().get({})))>) {
+                    std::apply(func, pack);
+                } else {
+                    std::apply([&func](const auto, auto &&...elem) { func(std::forward<decltype(elem)>(elem)...); }, pack);
+                }
+            });
+        }
+    }
+
     /**
      * @brief Returns an iterable object to use to _visit_ a view.
      *
@@ -1096,6 +1619,42 @@ public:
         }
     }
 
+    /**
+     * @brief Returns an iterable object to use to split a view in chunks.
+     *
+     * Each chunk is a tuple that contains a span of entities and a span of
+     * elements if they are non-empty ones. Both spans have the same size and
+     * refer to the same entities in the same order. The _constness_ of the
+     * elements is as requested. Column storages offer a tuple of spans instead,
+     * one for each data member.<br/>
+     * Chunks contain at most `length` entities and never cross a page of the
+     * underlying storage. With in-place deletion, chunks also end where
+     * tombstones are found.
+     *
+     * @note
+     * Chunks are disjoint. Therefore, they can be safely processed by multiple
+     * threads at once.
+     *
+     * @param length The maximum number of entities per chunk.
+     * @return An iterable object to use to split the view in chunks.
+     */
+    [[nodiscard]] chunk_iterable chunks(const size_type length) const noexcept {
+        ENTT_ASSERT(length != 0u, "Invalid chunk size");
+
+        if(auto *elem = storage(); elem != nullptr) {
+            if constexpr(Get::storage_policy == deletion_policy::in_place) {
+                const auto last = elem->size();
+                return chunk_iterable{{elem, {elem}, {}, 0u, last, length}, {elem, {elem}, {}, last, last, length}};
+            } else {
+                using chunk_iterator = chunk_iterable::iterator;
+                const auto len = base_type::size();
+                return chunk_iterable{{std::make_tuple(elem), 0u, len, length}, {std::make_tuple(elem), chunk_iterator::count(len, length), len, length}};
+            }
+        }
+
+        return chunk_iterable{};
+    }
+
     /**
      * @brief Combines a view and a storage in _more specific_ view.
      * @tparam OGet Type of storage to combine the view with.
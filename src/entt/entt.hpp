@@ -5,6 +5,7 @@ namespace entt {}
 #include "config/config.h"
 #include "config/macro.h"
 #include "config/version.h"
+#include "container/bitset.hpp"
 #include "container/dense_map.hpp"
 #include "container/dense_set.hpp"
 #include "container/table.hpp"
@@ -18,15 +19,19 @@ namespace entt {}
 #include "core/hashed_string.hpp"
 #include "core/ident.hpp"
 #include "core/iterator.hpp"
+#include "core/job_system.hpp"
 #include "core/memory.hpp"
+#include "core/mmap.hpp"
 #include "core/monostate.hpp"
 #include "core/ranges.hpp"
 #include "core/tuple.hpp"
 #include "core/type_info.hpp"
 #include "core/type_traits.hpp"
 #include "core/utility.hpp"
+#include "entity/command_buffer.hpp"
 #include "entity/component.hpp"
 #include "entity/entity.hpp"
+#include "entity/executor.hpp"
 #include "entity/group.hpp"
 #include "entity/handle.hpp"
 #include "entity/helper.hpp"
@@ -107,7 +107,8 @@ public:
      */
     explicit basic_process(const allocator_type &allocator)
         : next{nullptr, allocator},
-          current{state::idle} {}
+          current{state::idle},
+          standalone{} {}
 
     /*! @brief Default copy constructor, deleted on purpose. */
     basic_process(const basic_process &) = delete;
@@ -179,6 +180,26 @@ public:
         }
     }
 
+    /**
+     * @brief Marks a process as independent or not.
+     *
+     * Independent processes don't touch their scheduler nor other processes
+     * during an update. Therefore, a scheduler can tick them concurrently.
+     *
+     * @param value True to mark the process as independent, false otherwise.
+     */
+    void independent(const bool value) noexcept {
+        standalone = value;
+    }
+
+    /**
+     * @brief Returns true if a process is independent.
+     * @return True if the process is independent, false otherwise.
+     */
+    [[nodiscard]] bool independent() const noexcept {
+        return standalone;
+    }
+
     /**
      * @brief Returns true if a process is either running or paused.
      * @return True if the process is still alive, false otherwise.
@@ -285,6 +306,7 @@ public:
 private:
     compressed_pair<handle_type, allocator_type> next;
     state current;
+    bool standalone;
 };
 
 /*! @cond ENTT_INTERNAL */
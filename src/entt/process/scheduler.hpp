@@ -39,6 +39,20 @@ class basic_scheduler {
     using container_allocator = alloc_traits::template rebind_alloc<std::shared_ptr<base_type>>;
     using container_type = std::vector<std::shared_ptr<base_type>, container_allocator>;
 
+    void release(const std::size_t pos) {
+        // updating might spawn/reallocate, cannot hold refs until here
+        auto &elem = handlers.first()[pos];
+
+        if(elem->finished()) {
+            elem = elem->peek();
+        }
+
+        if(!elem || elem->rejected()) {
+            elem = std::move(handlers.first().back());
+            handlers.first().pop_back();
+        }
+    }
+
 public:
     /*! @brief Process type. */
     using type = base_type;
@@ -184,17 +198,51 @@ public:
         for(auto next = handlers.first().size(); next; --next) {
             const auto pos = next - 1u;
             handlers.first()[pos]->tick(delta, data);
-            // updating might spawn/reallocate, cannot hold refs until here
-            auto &elem = handlers.first()[pos];
+            release(pos);
+        }
+    }
+
+    /**
+     * @brief Updates all scheduled processes, independent ones in parallel.
+     *
+     * Independent processes are ticked concurrently by means of the given
+     * executor. All other processes are ticked afterwards on the calling
+     * thread, in the same order as for the sequential update.<br/>
+     * Terminated processes are replaced with their children or removed on the
+     * calling thread, in the same order as for the sequential update. The
+     * outcome is therefore deterministic.
+     *
+     * @sa basic_process::independent
+     *
+     * @tparam Executor Type of executor to use to run jobs.
+     * @param jobs A valid executor.
+     * @param delta Elapsed time.
+     * @param data Optional data, shared among all processes.
+     */
+    template<typename Executor>
+    void update(Executor &jobs, const delta_type delta, void *data = nullptr) {
+        const auto length = handlers.first().size();
+        // flags are read once, dependent processes can change them meanwhile
+        std::vector<bool, typename alloc_traits::template rebind_alloc<bool>> ticked(length, false, get_allocator());
 
-            if(elem->finished()) {
-                elem = elem->peek();
+        for(size_type pos{}; pos < length; ++pos) {
+            ticked[pos] = handlers.first()[pos]->independent();
+        }
+
+        jobs.parallel_for(length, [this, &ticked, delta, data](const size_type pos) {
+            if(ticked[pos]) {
+                handlers.first()[pos]->tick(delta, data);
             }
+        });
 
-            if(!elem || elem->rejected()) {
-                elem = std::move(handlers.first().back());
-                handlers.first().pop_back();
+        for(auto next = length; next; --next) {
+            const auto pos = next - 1u;
+
+            if(!ticked[pos]) {
+                handlers.first()[pos]->tick(delta, data);
             }
+
+            release(pos);
         }
     }
 
@@ -1,18 +1,25 @@
 #ifndef ENTT_SIGNAL_DISPATCHER_HPP
 #define ENTT_SIGNAL_DISPATCHER_HPP
 
+#include <atomic>
 #include <cstddef>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <new>
+#include <shared_mutex>
+#include <thread>
 #include <type_traits>
 #include <utility>
 #include <vector>
+#include "../config/config.h"
 #include "../container/dense_map.hpp"
 #include "../core/compressed_pair.hpp"
 #include "../core/concepts.hpp"
 #include "../core/fwd.hpp"
 #include "../core/type_info.hpp"
 #include "../stl/functional.hpp"
+#include "../stl/memory.hpp"
 #include "fwd.hpp"
 #include "sigh.hpp"
 
@@ -29,20 +36,214 @@ struct basic_dispatcher_handler {
     [[nodiscard]] virtual std::size_t size() const noexcept = 0;
 };
 
-template<cvref_unqualified Type, typename Allocator>
+struct dispatcher_no_mutex {};
+
+struct dispatcher_no_instance {};
+
+template<typename Type, typename... Args>
+void construct_event(Type *elem, Args &&...args) {
+    if constexpr(std::is_aggregate_v<Type> && (sizeof...(Args) != 0u || !std::is_default_constructible_v<Type>)) {
+        ::new(static_cast<void *>(elem)) Type{std::forward<Args>(args)...};
+    } else {
+        ::new(static_cast<void *>(elem)) Type(std::forward<Args>(args)...);
+    }
+}
+
+// single producer, single consumer queue made of fixed size segments
+template<typename Type, typename Allocator>
+class dispatcher_queue final {
+    static constexpr std::size_t length = 256u;
+
+    struct segment_type {
+        [[nodiscard]] Type *at(const std::size_t pos) noexcept {
+            return std::launder(reinterpret_cast<Type *>(storage + pos * sizeof(Type)));
+        }
+
+        std::atomic<std::size_t> committed{};
+        std::atomic<segment_type *> next{};
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, modernize-avoid-c-arrays)
+        alignas(Type) std::byte storage[sizeof(Type) * length];
+    };
+
+    using alloc_traits = std::allocator_traits<Allocator>::template rebind_traits<segment_type>;
+    using allocator_type = alloc_traits::allocator_type;
+
+    [[nodiscard]] segment_type *allocate() {
+        auto *elem = stl::to_address(alloc_traits::allocate(allocator, 1u));
+        alloc_traits::construct(allocator, elem);
+        return elem;
+    }
+
+    void deallocate(segment_type *elem) {
+        alloc_traits::destroy(allocator, elem);
+        alloc_traits::deallocate(allocator, elem, 1u);
+    }
+
+public:
+    dispatcher_queue(const Allocator &alloc, const std::thread::id id)
+        : allocator{alloc},
+          head{allocate()},
+          tail{head},
+          owner{id} {}
+
+    dispatcher_queue(const dispatcher_queue &) = delete;
+    dispatcher_queue(dispatcher_queue &&) = delete;
+
+    ~dispatcher_queue() {
+        pop([](Type &&) {});
+        deallocate(head);
+    }
+
+    dispatcher_queue &operator=(const dispatcher_queue &) = delete;
+    dispatcher_queue &operator=(dispatcher_queue &&) = delete;
+
+    template<typename... Args>
+    void push(Args &&...args) {
+        if(last == length) {
+            auto *elem = allocate();
+            tail->next.store(elem, std::memory_order_release);
+            tail = elem;
+            last = 0u;
+        }
+
+        construct_event(tail->at(last), std::forward<Args>(args)...);
+        tail->committed.store(++last, std::memory_order_release);
+    }
+
+    template<typename Func>
+    void pop(Func func) {
+        for(;;) {
+            for(const auto committed = head->committed.load(std::memory_order_acquire); first < committed; ++first) {
+                auto *elem = head->at(first);
+                func(std::move(*elem));
+                std::destroy_at(elem);
+            }
+
+            if(first != length) {
+                break;
+            }
+
+            // the producer never goes back to a segment once it publishes the next one
+            if(auto *next = head->next.load(std::memory_order_acquire); next != nullptr) {
+                deallocate(std::exchange(head, next));
+                first = 0u;
+            } else {
+                break;
+            }
+        }
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept {
+        std::size_t count = head->committed.load(std::memory_order_acquire) - first;
+
+        for(auto *curr = head->next.load(std::memory_order_acquire); curr != nullptr; curr = curr->next.load(std::memory_order_acquire)) {
+            count += curr->committed.load(std::memory_order_acquire);
+        }
+
+        return count;
+    }
+
+    [[nodiscard]] std::thread::id thread() const noexcept {
+        return owner;
+    }
+
+    dispatcher_queue *link{};
+
+private:
+    allocator_type allocator;
+    segment_type *head;
+    std::size_t first{};
+    segment_type *tail;
+    std::size_t last{};
+    std::thread::id owner;
+};
+
+template<cvref_unqualified Type, typename Allocator, dispatcher_policy Policy>
 class dispatcher_handler final: public basic_dispatcher_handler {
     using alloc_traits = std::allocator_traits<Allocator>;
     using signal_type = sigh<void(Type &), Allocator>;
     using container_type = std::vector<Type, typename alloc_traits::template rebind_alloc<Type>>;
+    using queue_type = dispatcher_queue<Type, Allocator>;
+    using queue_alloc_traits = alloc_traits::template rebind_traits<queue_type>;
+
+    struct cache_type {
+        std::size_t instance{};
+        queue_type *queue{};
+    };
+
+    [[nodiscard]] static std::size_t next_instance() noexcept {
+        static std::atomic<std::size_t> counter{};
+        return ++counter;
+    }
+
+    [[nodiscard]] queue_type &local() {
+        static thread_local cache_type cache{};
+
+        if(cache.instance != key) {
+            const auto id = std::this_thread::get_id();
+            auto *curr = queues.load(std::memory_order_acquire);
+
+            // only the calling thread can add a queue for itself, no need to recheck
+            for(; curr != nullptr && curr->thread() != id; curr = curr->link) {}
+
+            if(curr == nullptr) {
+                typename queue_alloc_traits::allocator_type allocator{signal.get_allocator()};
+                curr = stl::to_address(queue_alloc_traits::allocate(allocator, 1u));
+
+                ENTT_TRY {
+                    queue_alloc_traits::construct(allocator, curr, signal.get_allocator(), id);
+                }
+                ENTT_CATCH {
+                    queue_alloc_traits::deallocate(allocator, curr, 1u);
+                    ENTT_THROW;
+                }
+
+                curr->link = queues.load(std::memory_order_relaxed);
+                while(!queues.compare_exchange_weak(curr->link, curr, std::memory_order_release, std::memory_order_relaxed)) {}
+            }
+
+            cache = {key, curr};
+        }
+
+        return *cache.queue;
+    }
+
+    void drain() {
+        for(auto *curr = queues.load(std::memory_order_acquire); curr != nullptr; curr = curr->link) {
+            curr->pop([this](Type &&elem) { events.push_back(std::move(elem)); });
+        }
+    }
 
 public:
     using allocator_type = Allocator;
 
     dispatcher_handler(const allocator_type &allocator)
         : signal{allocator},
-          events{allocator} {}
+          events{allocator},
+          queues{},
+          key{next_instance()} {}
+
+    dispatcher_handler(const dispatcher_handler &) = delete;
+    dispatcher_handler(dispatcher_handler &&) = delete;
+
+    ~dispatcher_handler() override {
+        typename queue_alloc_traits::allocator_type allocator{signal.get_allocator()};
+
+        for(auto *curr = queues.load(std::memory_order_acquire); curr != nullptr;) {
+            auto *elem = std::exchange(curr, curr->link);
+            queue_alloc_traits::destroy(allocator, elem);
+            queue_alloc_traits::deallocate(allocator, elem, 1u);
+        }
+    }
+
+    dispatcher_handler &operator=(const dispatcher_handler &) = delete;
+    dispatcher_handler &operator=(dispatcher_handler &&) = delete;
 
     void publish() override {
+        if constexpr(Policy == dispatcher_policy::concurrent) {
+            drain();
+        }
+
         container_type other{};
         other.swap(events);
 
@@ -56,6 +257,12 @@ public:
     }
 
     void clear() noexcept override {
+        if constexpr(Policy == dispatcher_policy::concurrent) {
+            for(auto *curr = queues.load(std::memory_order_acquire); curr != nullptr; curr = curr->link) {
+                curr->pop([](Type &&) {});
+            }
+        }
+
         events.clear();
     }
 
@@ -69,7 +276,9 @@ public:
 
     template<typename... Args>
     void enqueue(Args &&...args) {
-        if constexpr(std::is_aggregate_v<Type> && (sizeof...(Args) != 0u || !std::is_default_constructible_v<Type>)) {
+        if constexpr(Policy == dispatcher_policy::concurrent) {
+            local().push(std::forward<Args>(args)...);
+        } else if constexpr(std::is_aggregate_v<Type> && (sizeof...(Args) != 0u || !std::is_default_constructible_v<Type>)) {
             events.push_back(Type{std::forward<Args>(args)...});
         } else {
             events.emplace_back(std::forward<Args>(args)...);
@@ -77,12 +286,22 @@ public:
     }
 
     [[nodiscard]] std::size_t size() const noexcept override {
-        return events.size();
+        std::size_t count = events.size();
+
+        if constexpr(Policy == dispatcher_policy::concurrent) {
+            for(auto *curr = queues.load(std::memory_order_acquire); curr != nullptr; curr = curr->link) {
+                count += curr->size();
+            }
+        }
+
+        return count;
     }
 
 private:
     signal_type signal;
     container_type events;
+    std::atomic<queue_type *> queues;
+    std::size_t key;
 };
 
 } // namespace internal
@@ -100,12 +319,23 @@ private:
  * The dispatcher creates instances of the `sigh` class internally. Refer to the
  * documentation of the latter for more details.
  *
+ * With the concurrent policy, events can be enqueued from any thread at the
+ * same time. Each producer appends to a queue of its own and the pending events
+ * are merged on the owning thread when they are delivered. The order of the
+ * events is preserved per thread and merged queues are visited in a stable
+ * order.<br/>
+ * All other functions are meant to be invoked from the owning thread only.
+ *
  * @tparam Allocator Type of allocator used to manage memory and elements.
+ * @tparam Policy Enqueue policy, either sequential or concurrent.
  */
-template<typename Allocator>
+template<typename Allocator, dispatcher_policy Policy>
 class basic_dispatcher {
     template<typename Type>
-    using handler_type = internal::dispatcher_handler<Type, Allocator>;
+    using handler_type = internal::dispatcher_handler<Type, Allocator, Policy>;
+
+    using mutex_type = std::conditional_t<Policy == dispatcher_policy::concurrent, std::shared_mutex, internal::dispatcher_no_mutex>;
+    using instance_type = std::conditional_t<Policy == dispatcher_policy::concurrent, std::size_t, internal::dispatcher_no_instance>;
 
     using key_type = id_type;
     // std::shared_ptr because of its type erased allocator which is useful here
@@ -115,8 +345,23 @@ class basic_dispatcher {
     using container_allocator = alloc_traits::template rebind_alloc<std::pair<const key_type, mapped_type>>;
     using container_type = dense_map<key_type, mapped_type, stl::identity, std::equal_to<>, container_allocator>;
 
+    struct cache_type {
+        std::size_t instance{};
+        id_type id{};
+        internal::basic_dispatcher_handler *handler{};
+    };
+
+    [[nodiscard]] static instance_type next_instance() noexcept {
+        if constexpr(Policy == dispatcher_policy::concurrent) {
+            static std::atomic<std::size_t> counter{};
+            return ++counter;
+        } else {
+            return instance_type{};
+        }
+    }
+
     template<cvref_unqualified Type>
-    [[nodiscard]] handler_type<Type> &assure(const id_type id) {
+    [[nodiscard]] handler_type<Type> &locate(const id_type id) {
         auto &&ptr = pools.first()[id];
 
         if(!ptr) {
@@ -127,15 +372,77 @@ class basic_dispatcher {
         return static_cast<handler_type<Type> &>(*ptr);
     }
 
+    template<cvref_unqualified Type>
+    [[nodiscard]] handler_type<Type> &assure(const id_type id) {
+        if constexpr(Policy == dispatcher_policy::concurrent) {
+            {
+                const std::shared_lock lock{mutex};
+
+                if(auto it = pools.first().find(id); it != pools.first().end()) {
+                    return static_cast<handler_type<Type> &>(*it->second);
+                }
+            }
+
+            const std::lock_guard lock{mutex};
+            return locate<Type>(id);
+        } else {
+            return locate<Type>(id);
+        }
+    }
+
     template<cvref_unqualified Type>
     [[nodiscard]] const handler_type<Type> *assure(const id_type id) const {
-        if(auto it = pools.first().find(id); it != pools.first().cend()) {
+        if constexpr(Policy == dispatcher_policy::concurrent) {
+            const std::shared_lock lock{mutex};
+
+            if(auto it = pools.first().find(id); it != pools.first().cend()) {
+                return static_cast<const handler_type<Type> *>(it->second.get());
+            }
+        } else if(auto it = pools.first().find(id); it != pools.first().cend()) {
             return static_cast<const handler_type<Type> *>(it->second.get());
         }
 
         return nullptr;
     }
 
+    template<cvref_unqualified Type>
+    [[nodiscard]] handler_type<Type> &producer(const id_type id) {
+        if constexpr(Policy == dispatcher_policy::concurrent) {
+            // producers rarely change queue, a per thread cache keeps them away from the lock
+            static thread_local cache_type cache{};
+
+            if(cache.instance != instance || cache.id != id) {
+                cache = {instance, id, &assure<Type>(id)};
+            }
+
+            return static_cast<handler_type<Type> &>(*cache.handler);
+        } else {
+            return assure<Type>(id);
+        }
+    }
+
+    template<typename Func>
+    void for_each(Func func) const {
+        if constexpr(Policy == dispatcher_policy::concurrent) {
+            // producers can add queues meanwhile, listeners are invoked without holding the lock
+            for(size_type pos{};; ++pos) {
+                internal::basic_dispatcher_handler *cpool{};
+
+                if(const std::shared_lock lock{mutex}; pos < pools.first().size()) {
+                    cpool = pools.first().begin()[static_cast<typename container_type::difference_type>(pos)].second.get();
+                } else {
+                    break;
+                }
+
+                func(*cpool);
+            }
+        } else {
+            for(auto &&cpool: pools.first()) {
+                func(*cpool.second);
+            }
+        }
+    }
+
 public:
     /*! @brief Allocator type. */
     using allocator_type = Allocator;
@@ -151,7 +458,9 @@ public:
      * @param allocator The allocator to use.
      */
     explicit basic_dispatcher(const allocator_type &allocator)
-        : pools{allocator, allocator} {}
+        : pools{allocator, allocator},
+          instance{next_instance()},
+          mutex{} {}
 
     /*! @brief Default copy constructor, deleted on purpose. */
     basic_dispatcher(const basic_dispatcher &) = delete;
@@ -161,7 +470,9 @@ public:
      * @param other The instance to move from.
      */
     basic_dispatcher(basic_dispatcher &&other) noexcept
-        : pools{std::move(other.pools)} {}
+        : pools{std::move(other.pools)},
+          instance{std::exchange(other.instance, next_instance())},
+          mutex{} {}
 
     /**
      * @brief Allocator-extended move constructor.
@@ -169,7 +480,9 @@ public:
      * @param allocator The allocator to use.
      */
     basic_dispatcher(basic_dispatcher &&other, const allocator_type &allocator)
-        : pools{container_type{std::move(other.pools.first()), allocator}, allocator} {
+        : pools{container_type{std::move(other.pools.first()), allocator}, allocator},
+          instance{std::exchange(other.instance, next_instance())},
+          mutex{} {
         ENTT_ASSERT(alloc_traits::is_always_equal::value || get_allocator() == other.get_allocator(), "Copying a dispatcher is not allowed");
     }
 
@@ -200,6 +513,7 @@ public:
     void swap(basic_dispatcher &other) noexcept {
         using std::swap;
         swap(pools, other.pools);
+        swap(instance, other.instance);
     }
 
     /**
@@ -217,7 +531,7 @@ public:
      * @return The number of pending events for the given type.
      */
     template<typename Type>
-    [[nodiscard]] size_type size(const id_type id = type_hash<Type>::value()) const noexcept {
+    [[nodiscard]] size_type size(const id_type id = type_hash<Type>::value()) const noexcept(Policy != dispatcher_policy::concurrent) {
         const auto *cpool = assure<std::decay_t<Type>>(id);
         return cpool ? cpool->size() : 0u;
     }
@@ -226,13 +540,9 @@ public:
      * @brief Returns the total number of pending events.
      * @return The total number of pending events.
      */
-    [[nodiscard]] size_type size() const noexcept {
+    [[nodiscard]] size_type size() const noexcept(Policy != dispatcher_policy::concurrent) {
         size_type count{};
-
-        for(auto &&cpool: pools.first()) {
-            count += cpool.second->size();
-        }
-
+        for_each([&count](auto &cpool) { count += cpool.size(); });
         return count;
     }
 
@@ -311,7 +621,7 @@ public:
      */
     template<typename Type, typename... Args>
     void enqueue_hint(const id_type id, Args &&...args) {
-        assure<Type>(id).enqueue(std::forward<Args>(args)...);
+        producer<Type>(id).enqueue(std::forward<Args>(args)...);
     }
 
     /**
@@ -322,7 +632,7 @@ public:
      */
     template<typename Type>
     void enqueue_hint(const id_type id, Type &&value) {
-        assure<std::decay_t<Type>>(id).enqueue(std::forward<Type>(value));
+        producer<std::decay_t<Type>>(id).enqueue(std::forward<Type>(value));
     }
 
     /**
@@ -344,9 +654,7 @@ public:
      */
     template<typename Type>
     void disconnect(Type *value_or_instance) {
-        for(auto &&cpool: pools.first()) {
-            cpool.second->disconnect(value_or_instance);
-        }
+        for_each([value_or_instance](auto &cpool) { cpool.disconnect(value_or_instance); });
     }
 
     /**
@@ -360,10 +668,8 @@ public:
     }
 
     /*! @brief Discards all the events queued so far. */
-    void clear() noexcept {
-        for(auto &&cpool: pools.first()) {
-            cpool.second->clear();
-        }
+    void clear() noexcept(Policy != dispatcher_policy::concurrent) {
+        for_each([](auto &cpool) { cpool.clear(); });
     }
 
     /**
@@ -378,13 +684,13 @@ public:
 
     /*! @brief Delivers all the pending events. */
     void update() const {
-        for(auto &&cpool: pools.first()) {
-            cpool.second->publish();
-        }
+        for_each([](auto &cpool) { cpool.publish(); });
     }
 
 private:
     compressed_pair<container_type, allocator_type> pools;
+    [[no_unique_address]] instance_type instance;
+    [[no_unique_address]] mutable mutex_type mutex;
 };
 
 } // namespace entt
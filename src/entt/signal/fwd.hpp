@@ -1,14 +1,23 @@
 #ifndef ENTT_SIGNAL_FWD_HPP
 #define ENTT_SIGNAL_FWD_HPP
 
+#include <cstdint>
 #include <memory>
 
 namespace entt {
 
+/*! @brief Dispatcher enqueue policy. */
+enum class dispatcher_policy : std::uint8_t {
+    /*! @brief Events are enqueued from a single thread at a time. */
+    sequential = 0u,
+    /*! @brief Events are enqueued concurrently from any thread. */
+    concurrent = 1u
+};
+
 template<typename>
 class delegate;
 
-template<typename = std::allocator<void>>
+template<typename = std::allocator<void>, dispatcher_policy = dispatcher_policy::sequential>
 class basic_dispatcher;
 
 template<typename, typename = std::allocator<void>>
@@ -27,6 +36,9 @@ class sigh;
 /*! @brief Alias declaration for the most common use case. */
 using dispatcher = basic_dispatcher<>;
 
+/*! @brief Alias declaration for the most common use case. */
+using concurrent_dispatcher = basic_dispatcher<std::allocator<void>, dispatcher_policy::concurrent>;
+
 /*! @brief Disambiguation tag for constructors and the like. */
 template<auto>
 struct connect_arg_t {
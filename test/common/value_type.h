@@ -15,6 +15,11 @@ struct pointer_stable_mixin: Type {
     using Type::operator=;
 };
 
+template<typename Type>
+struct bitset_tag_mixin: Type {
+    static constexpr auto bitset_tag = true;
+};
+
 template<typename Type>
 struct non_default_constructible_mixin: Type {
     using Type::Type;
@@ -93,6 +98,7 @@ using boxed_char = internal::value_type<char>;
 
 using empty = internal::empty_type;
 struct other_empty: internal::empty_type {};
+using bitset_empty = internal::bitset_tag_mixin<internal::empty_type>;
 
 using aggregate = internal::aggregate_type;
 
@@ -0,0 +1,149 @@
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/container/bitset.hpp>
+
+TEST(Bitset, Constructors) {
+    entt::bitset bitset{};
+
+    ASSERT_NO_THROW([[maybe_unused]] auto alloc = bitset.get_allocator());
+    ASSERT_TRUE(bitset.none());
+    ASSERT_EQ(bitset.size(), 0u);
+
+    bitset = entt::bitset{std::allocator<std::uint64_t>{}};
+    bitset.set(3u);
+
+    entt::bitset other{bitset, bitset.get_allocator()};
+
+    ASSERT_TRUE(other.test(3u));
+    ASSERT_EQ(other, bitset);
+
+    entt::bitset moved{std::move(other), bitset.get_allocator()};
+
+    ASSERT_TRUE(moved.test(3u));
+    ASSERT_EQ(moved, bitset);
+}
+
+TEST(Bitset, Functionalities) {
+    entt::bitset bitset{};
+
+    ASSERT_FALSE(bitset.test(0u));
+    ASSERT_FALSE(bitset.test(1024u));
+
+    bitset.set(0u);
+    bitset.set(63u);
+    bitset.set(64u);
+    bitset.set(4097u);
+
+    ASSERT_FALSE(bitset.none());
+    ASSERT_EQ(bitset.count(), 4u);
+    ASSERT_EQ(bitset.size(), 4160u);
+    ASSERT_TRUE(bitset.test(0u));
+    ASSERT_TRUE(bitset.test(63u));
+    ASSERT_TRUE(bitset.test(64u));
+    ASSERT_FALSE(bitset.test(65u));
+    ASSERT_TRUE(bitset.test(4097u));
+
+    bitset.reset(63u);
+    bitset.reset(1u << 20u);
+
+    ASSERT_FALSE(bitset.test(63u));
+    ASSERT_EQ(bitset.count(), 3u);
+
+    bitset.reset(4097u);
+    bitset.shrink_to_fit();
+
+    ASSERT_EQ(bitset.size(), 128u);
+    ASSERT_EQ(bitset.count(), 2u);
+
+    bitset.reserve(8192u);
+
+    ASSERT_GE(bitset.capacity(), 8192u);
+    ASSERT_EQ(bitset.size(), 128u);
+
+    bitset.clear();
+
+    ASSERT_TRUE(bitset.none());
+    ASSERT_EQ(bitset.size(), 0u);
+}
+
+TEST(Bitset, Iterator) {
+    entt::bitset bitset{};
+
+    ASSERT_EQ(bitset.begin(), bitset.end());
+
+    const std::vector<std::size_t> expected{2u, 64u, 65u, 127u, 5000u, 262145u};
+
+    for(const auto pos: expected) {
+        bitset.set(pos);
+    }
+
+    bitset.set(1000u);
+    bitset.reset(1000u);
+
+    const std::vector<std::size_t> values(bitset.cbegin(), bitset.cend());
+
+    ASSERT_EQ(values, expected);
+    ASSERT_EQ(std::distance(bitset.begin(), bitset.end()), static_cast<std::ptrdiff_t>(expected.size()));
+
+    auto it = bitset.begin();
+
+    ASSERT_EQ(*it++, 2u);
+    ASSERT_EQ(*++it, 65u);
+}
+
+TEST(Bitset, Algebra) {
+    entt::bitset lhs{};
+    entt::bitset rhs{};
+
+    lhs.set(1u);
+    lhs.set(100u);
+    lhs.set(5000u);
+
+    rhs.set(100u);
+    rhs.set(200u);
+
+    entt::bitset copy = lhs;
+    copy &= rhs;
+
+    ASSERT_EQ(copy.count(), 1u);
+    ASSERT_TRUE(copy.test(100u));
+    ASSERT_EQ(*copy.begin(), 100u);
+    ASSERT_EQ(++copy.begin(), copy.end());
+
+    copy = lhs;
+    copy -= rhs;
+
+    ASSERT_EQ(copy.count(), 2u);
+    ASSERT_TRUE(copy.test(1u));
+    ASSERT_FALSE(copy.test(100u));
+    ASSERT_TRUE(copy.test(5000u));
+
+    copy = rhs;
+    copy |= lhs;
+
+    ASSERT_EQ(copy.count(), 4u);
+    ASSERT_EQ(*std::next(copy.begin(), 3), 5000u);
+
+    copy -= copy;
+
+    ASSERT_TRUE(copy.none());
+    ASSERT_EQ(copy.begin(), copy.end());
+    ASSERT_EQ(copy, entt::bitset{});
+    ASSERT_NE(lhs, rhs);
+}
+
+TEST(Bitset, Swap) {
+    entt::bitset bitset{};
+    entt::bitset other{};
+
+    bitset.set(42u);
+    bitset.swap(other);
+
+    ASSERT_TRUE(bitset.none());
+    ASSERT_TRUE(other.test(42u));
+}
@@ -1,8 +1,12 @@
 #include <algorithm>
 #include <array>
+#include <cstddef>
+#include <functional>
 #include <vector>
 #include <gtest/gtest.h>
 #include <entt/core/algorithm.hpp>
+#include <entt/core/job_system.hpp>
+#include "../../common/config.h"
 #include "../../common/value_type.h"
 
 TEST(Algorithm, StdSort) {
@@ -61,6 +65,42 @@ TEST(Algorithm, InsertionSortEmptyContainer) {
     sort(vec.begin(), vec.end());
 }
 
+TEST(Algorithm, ParallelSort) {
+    entt::job_system jobs{4u};
+    std::vector<std::size_t> vec(entt::parallel_sort::threshold * 4u);
+    const entt::parallel_sort sort;
+
+    for(std::size_t pos{}; pos < vec.size(); ++pos) {
+        vec[pos] = (pos * 7919u) % vec.size();
+    }
+
+    sort(vec.begin(), vec.end(), std::less{}, jobs);
+
+    ASSERT_TRUE(std::is_sorted(vec.begin(), vec.end()));
+
+    for(std::size_t pos{}; pos < vec.size(); ++pos) {
+        ASSERT_EQ(vec[pos], pos);
+    }
+}
+
+TEST(Algorithm, ParallelSortBoxedInt) {
+    entt::job_system jobs{2u};
+    std::array arr{test::boxed_int{4}, test::boxed_int{1}, test::boxed_int{3}, test::boxed_int{2}, test::boxed_int{0}, test::boxed_int{8}};
+    const entt::parallel_sort sort;
+
+    sort(arr.begin(), arr.end(), [](const auto &lhs, const auto &rhs) { return lhs.value > rhs.value; }, jobs);
+
+    ASSERT_TRUE(std::is_sorted(arr.rbegin(), arr.rend()));
+}
+
+TEST(Algorithm, ParallelSortEmptyContainer) {
+    entt::job_system jobs{2u};
+    std::vector<int> vec{};
+    const entt::parallel_sort sort;
+    // this should crash with asan enabled if we break the constraint
+    sort(vec.begin(), vec.end(), std::less{}, jobs);
+}
+
 TEST(Algorithm, RadixSort) {
     std::array arr{4u, 1u, 3u, 2u, 0u};
     const entt::radix_sort<8, 32> sort;
@@ -89,3 +129,82 @@ TEST(Algorithm, RadixSortEmptyContainer) {
     // this should crash with asan enabled if we break the constraint
     sort(vec.begin(), vec.end());
 }
+
+TEST(Algorithm, RadixSortAuxiliaryBuffer) {
+    std::array arr{4u, 1u, 3u, 2u, 0u};
+    std::vector<unsigned int> aux{};
+    const entt::radix_sort<8, 32> sort;
+
+    sort(arr.begin(), arr.end(), [](const auto &value) { return value; }, aux);
+
+    ASSERT_TRUE(std::is_sorted(arr.begin(), arr.end()));
+    ASSERT_EQ(aux.size(), arr.size());
+
+    std::array other{2u, 0u, 1u};
+    sort(other.begin(), other.end(), [](const auto &value) { return value; }, aux);
+
+    ASSERT_TRUE(std::is_sorted(other.begin(), other.end()));
+    ASSERT_EQ(aux.size(), arr.size());
+}
+
+TEST(Algorithm, ParallelRadixSort) {
+    entt::job_system jobs{4u};
+    std::vector<std::size_t> vec(10000u);
+    const entt::parallel_radix_sort<8, 16> sort;
+
+    for(std::size_t pos{}; pos < vec.size(); ++pos) {
+        vec[pos] = (pos * 7919u) % vec.size();
+    }
+
+    sort(vec.begin(), vec.end(), [](const auto &value) { return value; }, jobs);
+
+    for(std::size_t pos{}; pos < vec.size(); ++pos) {
+        ASSERT_EQ(vec[pos], pos);
+    }
+}
+
+TEST(Algorithm, ParallelRadixSortBoxedInt) {
+    entt::job_system jobs{2u};
+    std::array arr{test::boxed_int{4}, test::boxed_int{1}, test::boxed_int{3}, test::boxed_int{2}, test::boxed_int{0}, test::boxed_int{8}};
+    std::vector<test::boxed_int> aux{};
+    const entt::parallel_radix_sort<2, 6, 4> sort;
+
+    sort(arr.rbegin(), arr.rend(), [](const auto &instance) { return instance.value; }, jobs, aux);
+
+    ASSERT_TRUE(std::is_sorted(arr.rbegin(), arr.rend()));
+    ASSERT_EQ(aux.size(), arr.size());
+}
+
+TEST(Algorithm, ParallelRadixSortStable) {
+    entt::job_system jobs{4u};
+    std::vector<std::size_t> vec(4096u);
+    const entt::parallel_radix_sort<4, 4> sort;
+
+    for(std::size_t pos{}; pos < vec.size(); ++pos) {
+        vec[pos] = ((pos % 16u) << 12u) | pos;
+    }
+
+    sort(vec.begin(), vec.end(), [](const auto &value) { return value >> 12u; }, jobs);
+
+    ASSERT_TRUE(std::is_sorted(vec.begin(), vec.end()));
+}
+
+ENTT_DEBUG_TEST(AlgorithmDeathTest, ParallelRadixSort) {
+    std::array arr{4u, 1u, 256u, 2u, 0u};
+    const entt::parallel_radix_sort<4, 8, 2> sort;
+
+    ASSERT_DEATH(
+        {
+            entt::job_system jobs{2u};
+            sort(arr.begin(), arr.end(), [](const auto &value) { return value; }, jobs);
+        },
+        "");
+}
+
+TEST(Algorithm, ParallelRadixSortEmptyContainer) {
+    entt::job_system jobs{2u};
+    std::vector<int> vec{};
+    const entt::parallel_radix_sort<8, 32> sort;
+    // this should crash with asan enabled if we break the constraint
+    sort(vec.begin(), vec.end(), [](const auto &value) { return value; }, jobs);
+}
@@ -0,0 +1,125 @@
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/core/job_system.hpp>
+
+TEST(JobSystem, Functionalities) {
+    entt::job_system jobs{4u};
+    entt::job_system other{0u};
+
+    ASSERT_EQ(jobs.concurrency(), 4u);
+    ASSERT_EQ(other.concurrency(), 1u);
+}
+
+TEST(JobSystem, Job) {
+    entt::job_system jobs{};
+    std::size_t value{};
+
+    auto func = [&value]() { ++value; };
+    entt::job elem{func};
+
+    ASSERT_FALSE(elem.done());
+    ASSERT_FALSE(elem.failed());
+
+    jobs.submit(elem);
+    jobs.wait(elem);
+
+    ASSERT_TRUE(elem.done());
+    ASSERT_FALSE(elem.failed());
+    ASSERT_EQ(value, 1u);
+}
+
+TEST(JobSystem, RawJob) {
+    entt::job_system jobs{2u};
+    std::atomic<std::size_t> value{};
+
+    entt::job elem{+[](const void *payload) { ++*static_cast<std::atomic<std::size_t> *>(const_cast<void *>(payload)); }, &value};
+
+    jobs.submit(elem);
+    jobs.wait(elem);
+
+    ASSERT_EQ(value, 1u);
+}
+
+TEST(JobSystem, Children) {
+    entt::job_system jobs{4u};
+    std::atomic<std::size_t> counter{};
+    std::array<std::optional<entt::job>, 8u> children{};
+
+    auto noop = []() {};
+    auto task = [&counter]() { ++counter; };
+    entt::job root{noop};
+
+    auto func = [&]() {
+        for(auto &&elem: children) {
+            jobs.submit(elem.emplace(task, &root));
+        }
+    };
+
+    entt::job parent{func, &root};
+
+    jobs.submit(parent);
+    jobs.submit(root);
+    jobs.wait(root);
+
+    ASSERT_TRUE(parent.done());
+    ASSERT_TRUE(root.done());
+    ASSERT_EQ(counter, children.size());
+
+    for(auto &&elem: children) {
+        ASSERT_TRUE(elem->done());
+    }
+}
+
+TEST(JobSystem, Join) {
+    entt::job_system jobs{4u};
+    std::size_t lhs{};
+    std::size_t rhs{};
+
+    jobs.join([&lhs]() { lhs = 1u; }, [&rhs]() { rhs = 2u; });
+
+    ASSERT_EQ(lhs, 1u);
+    ASSERT_EQ(rhs, 2u);
+}
+
+TEST(JobSystem, ParallelFor) {
+    entt::job_system jobs{4u};
+    std::vector<std::size_t> value(1024u);
+
+    jobs.parallel_for(value.size(), [&value](const std::size_t pos) { value[pos] = pos; });
+
+    for(std::size_t pos{}; pos < value.size(); ++pos) {
+        ASSERT_EQ(value[pos], pos);
+    }
+
+    std::atomic<std::size_t> counter{};
+
+    jobs.parallel_for(0u, [&counter](const std::size_t) { ++counter; });
+
+    ASSERT_EQ(counter, 0u);
+
+    jobs.parallel_for(4096u, [&jobs, &counter](const std::size_t) {
+        jobs.parallel_for(4u, [&counter](const std::size_t) { ++counter; });
+    });
+
+    ASSERT_EQ(counter, 4096u * 4u);
+}
+
+TEST(JobSystem, Throw) {
+    entt::job_system jobs{2u};
+
+    auto func = []() { throw std::runtime_error{"job failure"}; };
+    entt::job elem{func};
+
+    jobs.submit(elem);
+
+    ASSERT_THROW(jobs.wait(elem), std::runtime_error);
+    ASSERT_TRUE(elem.done());
+    ASSERT_TRUE(elem.failed());
+
+    ASSERT_THROW(jobs.parallel_for(64u, [](const std::size_t pos) { if(pos == 42u) { throw std::runtime_error{"job failure"}; } }), std::runtime_error);
+}
@@ -1,5 +1,6 @@
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <tuple>
 #include <type_traits>
@@ -194,3 +195,108 @@ TEST(UninitializedConstructUsingAllocator, UsesAllocatorConstruction) {
 }
 
 #endif
+
+TEST(PagePool, Functionalities) {
+    constexpr auto size = entt::page_pool::min_block_size;
+    entt::page_pool pool{};
+
+    ASSERT_EQ(pool.cached(), 0u);
+
+    void *page = pool.allocate(size);
+    void *other = pool.allocate(size, entt::page_pool::block_alignment);
+
+    ASSERT_NE(page, other);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(other) % entt::page_pool::block_alignment, 0u);
+
+    pool.deallocate(page, size);
+    pool.deallocate(other, size, entt::page_pool::block_alignment);
+
+    ASSERT_EQ(pool.cached(), 2u * size);
+    ASSERT_EQ(pool.allocate(size, entt::page_pool::block_alignment), other);
+    ASSERT_EQ(pool.allocate(size), page);
+    ASSERT_EQ(pool.cached(), 0u);
+
+    pool.deallocate(page, size);
+    pool.deallocate(other, size);
+    pool.trim(size);
+
+    ASSERT_EQ(pool.cached(), size);
+
+    pool.release();
+
+    ASSERT_EQ(pool.cached(), 0u);
+}
+
+TEST(PagePool, SizeClasses) {
+    entt::page_pool pool{};
+
+    // size classes are distinct, blocks are never handed out for other sizes
+    void *page = pool.allocate(entt::page_pool::min_block_size);
+    pool.deallocate(page, entt::page_pool::min_block_size);
+
+    void *other = pool.allocate(2u * entt::page_pool::min_block_size);
+
+    ASSERT_NE(other, page);
+    ASSERT_EQ(pool.cached(), entt::page_pool::min_block_size);
+
+    pool.deallocate(other, 2u * entt::page_pool::min_block_size);
+
+    ASSERT_EQ(pool.cached(), 3u * entt::page_pool::min_block_size);
+
+    pool.release();
+
+    // other sizes and alignments go straight to the global allocator
+    pool.deallocate(pool.allocate(64u), 64u);
+    pool.deallocate(pool.allocate(3u * entt::page_pool::min_block_size), 3u * entt::page_pool::min_block_size);
+    pool.deallocate(pool.allocate(2u * entt::page_pool::max_block_size), 2u * entt::page_pool::max_block_size);
+    pool.deallocate(pool.allocate(entt::page_pool::min_block_size, 2u * entt::page_pool::block_alignment), entt::page_pool::min_block_size, 2u * entt::page_pool::block_alignment);
+
+    ASSERT_EQ(pool.cached(), 0u);
+
+    pool.deallocate(pool.allocate(entt::page_pool::max_block_size), entt::page_pool::max_block_size);
+
+    ASSERT_EQ(pool.cached(), entt::page_pool::max_block_size);
+}
+
+TEST(PagePool, Limit) {
+    constexpr auto size = entt::page_pool::min_block_size;
+    entt::page_pool pool{2u * size};
+
+    void *page = pool.allocate(size);
+    void *other = pool.allocate(size);
+    void *last = pool.allocate(2u * size);
+
+    pool.deallocate(page, size);
+    pool.deallocate(last, 2u * size);
+
+    ASSERT_EQ(pool.cached(), size);
+
+    pool.deallocate(other, size);
+
+    ASSERT_EQ(pool.cached(), 2u * size);
+}
+
+TEST(PageAllocator, Functionalities) {
+    entt::page_pool pool{};
+    entt::page_pool other{};
+
+    const entt::page_allocator<int> allocator{pool};
+    const entt::page_allocator<char> rebound{allocator};
+
+    ASSERT_EQ(allocator, rebound);
+    ASSERT_NE(allocator, entt::page_allocator<int>{other});
+    ASSERT_EQ(&rebound.resource(), &pool);
+
+    std::vector<int, entt::page_allocator<int>> vec{allocator};
+    vec.reserve(1024u);
+
+    const auto *data = vec.data();
+    vec.shrink_to_fit();
+
+    ASSERT_EQ(pool.cached(), 1024u * sizeof(int));
+
+    vec.reserve(1024u);
+
+    ASSERT_EQ(vec.data(), data);
+    ASSERT_EQ(pool.cached(), 0u);
+}
@@ -0,0 +1,75 @@
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/core/mmap.hpp>
+#include <entt/entity/registry.hpp>
+
+TEST(MmapPageAllocator, Functionalities) {
+    using allocator_type = entt::mmap_page_allocator<int>;
+
+    allocator_type allocator{};
+    const entt::mmap_page_allocator<char> other{allocator};
+    constexpr auto length = allocator_type::huge_page_size / sizeof(int);
+
+    ASSERT_EQ(allocator, other);
+    ASSERT_FALSE(allocator_type::mapped(0u));
+    ASSERT_FALSE(allocator_type::mapped(length - 1u));
+
+    int *small = allocator.allocate(4u);
+    int *large = allocator.allocate(length + 1u);
+
+    ASSERT_NE(small, nullptr);
+    ASSERT_NE(large, nullptr);
+
+    small[3u] = 3;
+    large[0u] = 0;
+    large[length] = 1;
+
+    ASSERT_EQ(small[3u], 3);
+    ASSERT_EQ(large[0u], 0);
+    ASSERT_EQ(large[length], 1);
+
+    allocator.deallocate(large, length + 1u);
+    allocator.deallocate(small, 4u);
+}
+
+TEST(MmapPageAllocator, Mapped) {
+    using allocator_type = entt::mmap_page_allocator<std::uint64_t>;
+    constexpr auto length = allocator_type::huge_page_size / sizeof(std::uint64_t);
+
+#if __has_include(<sys/mman.h>)
+    ASSERT_TRUE(allocator_type::mapped(length));
+#else
+    ASSERT_FALSE(allocator_type::mapped(length));
+#endif
+
+    std::vector<std::uint64_t, allocator_type> vec(length, 1u);
+
+    vec.resize(length * 2u, 2u);
+
+    ASSERT_EQ(vec.front(), 1u);
+    ASSERT_EQ(vec[length - 1u], 1u);
+    ASSERT_EQ(vec[length], 2u);
+    ASSERT_EQ(vec.back(), 2u);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(vec.data()) % alignof(std::uint64_t), 0u);
+
+#if __has_include(<sys/mman.h>)
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(vec.data()) % allocator_type::huge_page_size, 0u);
+#endif
+}
+
+TEST(MmapPageAllocator, Registry) {
+    entt::basic_registry<entt::entity, entt::mmap_page_allocator<entt::entity>> registry{};
+    std::vector<entt::entity> entity(4096u);
+
+    registry.create(entity.begin(), entity.end());
+    registry.insert<int>(entity.begin(), entity.end(), 3);
+
+    ASSERT_EQ(registry.storage<int>().size(), entity.size());
+    ASSERT_EQ(registry.get<int>(entity.back()), 3);
+
+    registry.destroy(entity.begin(), entity.end());
+
+    ASSERT_TRUE(registry.storage<int>().empty());
+}
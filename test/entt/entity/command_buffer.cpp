@@ -0,0 +1,185 @@
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <gtest/gtest.h>
+#include <entt/core/job_system.hpp>
+#include <entt/entity/command_buffer.hpp>
+#include <entt/entity/entity.hpp>
+#include <entt/entity/registry.hpp>
+#include "../../common/value_type.h"
+
+TEST(CommandBuffer, Placeholder) {
+    entt::command_buffer buffer{};
+    entt::registry registry{};
+
+    const auto entity = registry.create();
+    const auto placeholder = buffer.create();
+    const auto other = buffer.create();
+
+    ASSERT_FALSE(entt::command_buffer::placeholder(entity));
+    ASSERT_FALSE(entt::command_buffer::placeholder(entt::null));
+    ASSERT_TRUE(entt::command_buffer::placeholder(placeholder));
+    ASSERT_TRUE(entt::command_buffer::placeholder(other));
+    ASSERT_NE(placeholder, other);
+
+    ASSERT_FALSE(registry.valid(placeholder));
+    ASSERT_FALSE(registry.valid(other));
+}
+
+TEST(CommandBuffer, Flush) {
+    entt::command_buffer buffer{};
+    entt::registry registry{};
+
+    const auto entity = registry.create();
+    const auto other = registry.create();
+
+    registry.emplace<int>(entity, 1);
+    registry.emplace<char>(other, 'c');
+
+    const auto placeholder = buffer.create();
+
+    buffer.emplace<int>(placeholder, 3);
+    buffer.emplace<test::empty>(placeholder);
+    buffer.emplace<char>(entity, 'e');
+    buffer.remove<int, char>(other);
+    buffer.remove<int>(entity);
+    buffer.emplace<int>(entity, 2);
+    buffer.destroy(other);
+
+    ASSERT_EQ(registry.get<int>(entity), 1);
+    ASSERT_TRUE(registry.valid(other));
+    ASSERT_EQ(registry.storage<entt::entity>().size(), 2u);
+
+    buffer.flush(registry);
+
+    ASSERT_EQ(registry.storage<entt::entity>().size(), 3u);
+    ASSERT_EQ(registry.get<int>(entity), 2);
+    ASSERT_EQ(registry.get<char>(entity), 'e');
+    ASSERT_FALSE(registry.valid(other));
+
+    const auto [elem, value] = *registry.view<test::empty, int>().each().begin();
+
+    ASSERT_NE(elem, entity);
+    ASSERT_FALSE(entt::command_buffer::placeholder(elem));
+    ASSERT_EQ(value, 3);
+
+    buffer.flush(registry);
+
+    ASSERT_EQ(registry.storage<entt::entity>().size(), 3u);
+    ASSERT_EQ(registry.storage<int>().size(), 2u);
+}
+
+TEST(CommandBuffer, EmplaceThenRemove) {
+    entt::command_buffer buffer{};
+    entt::registry registry{};
+
+    const auto entity = registry.create();
+    const auto placeholder = buffer.create();
+
+    buffer.emplace<int>(entity, 1);
+    buffer.emplace<test::empty>(entity);
+    buffer.emplace<int>(placeholder, 2);
+    buffer.remove<int, test::empty>(entity);
+    buffer.remove<int>(placeholder);
+
+    buffer.flush(registry);
+
+    ASSERT_FALSE((registry.any_of<int, test::empty>(entity)));
+    ASSERT_TRUE(registry.storage<int>().empty());
+    ASSERT_EQ(registry.storage<entt::entity>().size(), 2u);
+}
+
+TEST(CommandBuffer, RemoveThenEmplace) {
+    entt::command_buffer buffer{};
+    entt::registry registry{};
+
+    const auto entity = registry.create();
+    const auto other = registry.create();
+
+    registry.emplace<int>(entity, 1);
+
+    buffer.remove<int, test::empty>(entity);
+    buffer.emplace<int>(entity, 2);
+    buffer.emplace<test::empty>(entity);
+    buffer.emplace<int>(other, 3);
+    buffer.remove<int>(other);
+    buffer.emplace<int>(other, 4);
+
+    buffer.flush(registry);
+
+    ASSERT_EQ(registry.get<int>(entity), 2);
+    ASSERT_TRUE(registry.all_of<test::empty>(entity));
+    ASSERT_EQ(registry.get<int>(other), 4);
+}
+
+TEST(CommandBuffer, Clear) {
+    entt::command_buffer buffer{};
+    entt::registry registry{};
+
+    const auto entity = registry.create();
+
+    buffer.emplace<int>(buffer.create(), 0);
+    buffer.emplace<int>(entity, 1);
+    buffer.destroy(entity);
+    buffer.clear();
+    buffer.flush(registry);
+
+    ASSERT_TRUE(registry.valid(entity));
+    ASSERT_EQ(registry.storage<entt::entity>().size(), 1u);
+    ASSERT_FALSE(registry.all_of<int>(entity));
+
+    const auto placeholder = buffer.create();
+
+    ASSERT_EQ(entt::to_entity(placeholder), 0u);
+}
+
+TEST(CommandBuffer, MoveOnlyType) {
+    entt::command_buffer buffer{};
+    entt::registry registry{};
+
+    const auto placeholder = buffer.create();
+    buffer.emplace<std::unique_ptr<int>>(placeholder, std::make_unique<int>(4));
+    buffer.flush(registry);
+
+    const auto &[entity, value] = *registry.view<std::unique_ptr<int>>().each().begin();
+
+    ASSERT_TRUE(registry.valid(entity));
+    ASSERT_EQ(*value, 4);
+}
+
+TEST(CommandBuffer, Concurrent) {
+    entt::job_system jobs{4u};
+    entt::command_buffer buffer{};
+    entt::registry registry{};
+    std::array<entt::entity, 256u> entity{};
+
+    registry.create(entity.begin(), entity.end());
+
+    jobs.parallel_for(entity.size(), [&](const std::size_t pos) {
+        const auto placeholder = buffer.create();
+        buffer.emplace<std::size_t>(placeholder, pos);
+        buffer.emplace<int>(entity[pos], static_cast<int>(pos));
+
+        if(pos % 2u) {
+            buffer.destroy(entity[pos]);
+        }
+    });
+
+    buffer.flush(registry);
+
+    ASSERT_EQ(registry.storage<entt::entity>().size(), entity.size() * 2u);
+    ASSERT_EQ(registry.storage<entt::entity>().free_list(), entity.size() + entity.size() / 2u);
+    ASSERT_EQ(registry.storage<std::size_t>().size(), entity.size());
+    ASSERT_EQ(registry.storage<int>().size(), entity.size() / 2u);
+
+    for(std::size_t pos{}; pos < entity.size(); pos += 2u) {
+        ASSERT_EQ(registry.get<int>(entity[pos]), static_cast<int>(pos));
+    }
+
+    std::array<bool, 256u> found{};
+
+    for(auto [elem, value]: registry.view<std::size_t>().each()) {
+        ASSERT_FALSE(found[value]);
+        found[value] = true;
+    }
+}
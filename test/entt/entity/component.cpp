@@ -1,6 +1,7 @@
 #include <type_traits>
 #include <gtest/gtest.h>
 #include <entt/config/config.h>
+#include <entt/core/type_traits.hpp>
 #include <entt/entity/component.hpp>
 #include "../../common/value_type.h"
 
@@ -11,9 +12,18 @@ struct ComponentBase: testing::Test {
     struct self_contained {
         static constexpr auto in_place_delete = true;
         static constexpr auto page_size = 4u;
+        static constexpr auto page_alignment = 64u;
+        static constexpr auto prefetch_distance = 8u;
     };
 
     struct traits_based {};
+
+    struct columnar {
+        int value;
+        char other;
+
+        using columns = entt::value_list<&columnar::value, &columnar::other>;
+    };
 };
 
 template<>
@@ -57,6 +67,7 @@ TYPED_TEST(Component, VoidType) {
 
     ASSERT_FALSE(traits_type::in_place_delete);
     ASSERT_EQ(traits_type::page_size, 0u);
+    ASSERT_EQ(traits_type::page_alignment, 0u);
 }
 
 TYPED_TEST(Component, Empty) {
@@ -64,6 +75,15 @@ TYPED_TEST(Component, Empty) {
 
     ASSERT_FALSE(traits_type::in_place_delete);
     ASSERT_EQ(traits_type::page_size, 0u);
+    ASSERT_FALSE(traits_type::bitset_tag);
+}
+
+TYPED_TEST(Component, BitsetTag) {
+    using traits_type = entt::component_traits<test::bitset_empty, typename TestFixture::entity_type>;
+
+    ASSERT_FALSE(traits_type::in_place_delete);
+    ASSERT_EQ(traits_type::page_size, 0u);
+    ASSERT_TRUE(traits_type::bitset_tag);
 }
 
 TYPED_TEST(Component, NonEmpty) {
@@ -71,6 +91,17 @@ TYPED_TEST(Component, NonEmpty) {
 
     ASSERT_FALSE(traits_type::in_place_delete);
     ASSERT_EQ(traits_type::page_size, ENTT_PACKED_PAGE);
+    ASSERT_EQ(traits_type::page_alignment, alignof(test::boxed_int));
+    ASSERT_EQ(traits_type::prefetch_distance, 0u);
+    testing::StaticAssertTypeEq<typename traits_type::columns, entt::value_list<>>();
+}
+
+TYPED_TEST(Component, Columns) {
+    using traits_type = entt::component_traits<ComponentBase::columnar, typename TestFixture::entity_type>;
+
+    ASSERT_FALSE(traits_type::in_place_delete);
+    ASSERT_EQ(traits_type::page_size, ENTT_PACKED_PAGE);
+    testing::StaticAssertTypeEq<typename traits_type::columns, entt::value_list<&ComponentBase::columnar::value, &ComponentBase::columnar::other>>();
 }
 
 TYPED_TEST(Component, NonMovable) {
@@ -85,6 +116,8 @@ TYPED_TEST(Component, SelfContained) {
 
     ASSERT_TRUE(traits_type::in_place_delete);
     ASSERT_EQ(traits_type::page_size, 4u);
+    ASSERT_EQ(traits_type::page_alignment, 64u);
+    ASSERT_EQ(traits_type::prefetch_distance, 8u);
 }
 
 TYPED_TEST(Component, TraitsBased) {
@@ -0,0 +1,169 @@
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <gtest/gtest.h>
+#include <entt/core/job_system.hpp>
+#include <entt/entity/executor.hpp>
+#include <entt/entity/organizer.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/view.hpp>
+
+struct Executor: testing::Test {
+    struct stamp {
+        std::atomic<std::size_t> *counter{};
+        std::size_t value{};
+    };
+
+    static void rw_int(stamp &curr, entt::view<entt::get_t<int>> view) {
+        for(auto [entt, value]: view.each()) {
+            value = static_cast<int>(entt::to_integral(entt));
+        }
+
+        curr.value = ++*curr.counter;
+    }
+
+    static void ro_int(stamp &curr, entt::view<entt::get_t<const int>>) {
+        curr.value = ++*curr.counter;
+    }
+
+    static void sync_point(stamp &curr, entt::registry &) {
+        curr.value = ++*curr.counter;
+    }
+
+    static void rw_char(stamp &curr, entt::view<entt::get_t<char>>) {
+        curr.value = ++*curr.counter;
+    }
+
+    static void throw_on_call(stamp &, entt::view<entt::get_t<double>>) {
+        throw std::runtime_error{"task failure"};
+    }
+
+    static void ro_double(stamp &curr, entt::view<entt::get_t<const double>>) {
+        curr.value = ++*curr.counter;
+    }
+};
+
+TEST_F(Executor, Functionalities) {
+    entt::job_system jobs{4u};
+    entt::job_system single{0u};
+    entt::executor executor{jobs};
+    entt::executor other{single};
+
+    ASSERT_EQ(executor.concurrency(), 4u);
+    ASSERT_EQ(other.concurrency(), 1u);
+}
+
+TEST_F(Executor, Run) {
+    entt::job_system jobs{4u};
+    entt::executor executor{jobs};
+    entt::organizer organizer;
+    entt::registry registry;
+
+    std::atomic<std::size_t> counter{};
+    stamp writer{&counter}, first{&counter}, second{&counter}, other{&counter}, sync{&counter}, last{&counter};
+
+    organizer.emplace<&rw_int>(writer, "writer");
+    organizer.emplace<&ro_int>(first, "first");
+    organizer.emplace<&ro_int>(second, "second");
+    organizer.emplace<&rw_char>(other, "other");
+    organizer.emplace<&sync_point>(sync, "sync");
+    organizer.emplace<&ro_int>(last, "last");
+
+    const auto graph = organizer.graph();
+
+    for(std::size_t iteration{}; iteration < 16u; ++iteration) {
+        counter = 0u;
+
+        ASSERT_NO_THROW(executor.run(graph, registry));
+
+        ASSERT_EQ(counter, 6u);
+
+        ASSERT_LT(writer.value, first.value);
+        ASSERT_LT(writer.value, second.value);
+        ASSERT_LT(first.value, sync.value);
+        ASSERT_LT(second.value, sync.value);
+        ASSERT_LT(other.value, sync.value);
+        ASSERT_LT(sync.value, last.value);
+    }
+}
+
+TEST_F(Executor, Prepare) {
+    entt::job_system jobs{2u};
+    entt::executor executor{jobs};
+    entt::organizer organizer;
+    entt::registry registry;
+
+    std::atomic<std::size_t> counter{};
+    stamp writer{&counter}, other{&counter};
+
+    organizer.emplace<&rw_int>(writer);
+    organizer.emplace<&rw_char>(other);
+
+    ASSERT_EQ(registry.storage(entt::type_hash<int>::value()), nullptr);
+    ASSERT_EQ(registry.storage(entt::type_hash<char>::value()), nullptr);
+
+    const auto entity = registry.create();
+    executor.run(organizer.graph(), registry);
+
+    ASSERT_NE(registry.storage(entt::type_hash<int>::value()), nullptr);
+    ASSERT_NE(registry.storage(entt::type_hash<char>::value()), nullptr);
+    ASSERT_FALSE(registry.all_of<int>(entity));
+    ASSERT_EQ(counter, 2u);
+}
+
+TEST_F(Executor, Empty) {
+    entt::job_system jobs{};
+    entt::executor executor{jobs};
+    entt::registry registry;
+
+    ASSERT_NO_THROW(executor.run({}, registry));
+}
+
+TEST_F(Executor, Throw) {
+    entt::job_system jobs{2u};
+    entt::executor executor{jobs};
+    entt::organizer organizer;
+    entt::registry registry;
+
+    std::atomic<std::size_t> counter{};
+    stamp failure{&counter}, sync{&counter};
+
+    organizer.emplace<&throw_on_call>(failure);
+    organizer.emplace<&sync_point>(sync);
+
+    const auto graph = organizer.graph();
+
+    ASSERT_THROW(executor.run(graph, registry), std::runtime_error);
+    ASSERT_EQ(counter, 0u);
+
+    organizer.clear();
+    organizer.emplace<&sync_point>(sync);
+
+    ASSERT_NO_THROW(executor.run(organizer.graph(), registry));
+    ASSERT_EQ(counter, 1u);
+}
+
+TEST_F(Executor, ThrowSkipsSuccessors) {
+    entt::job_system jobs{4u};
+    entt::executor executor{jobs};
+    entt::organizer organizer;
+    entt::registry registry;
+
+    std::atomic<std::size_t> counter{};
+    stamp failure{&counter}, first{&counter}, second{&counter};
+
+    organizer.emplace<&throw_on_call>(failure);
+    organizer.emplace<&ro_double>(first);
+    organizer.emplace<&ro_double>(second);
+
+    const auto graph = organizer.graph();
+
+    ASSERT_TRUE(graph[0u].top_level());
+    ASSERT_FALSE(graph[1u].top_level());
+    ASSERT_FALSE(graph[2u].top_level());
+
+    for(std::size_t iteration{}; iteration < 64u; ++iteration) {
+        ASSERT_THROW(executor.run(graph, registry), std::runtime_error);
+        ASSERT_EQ(counter, 0u);
+    }
+}
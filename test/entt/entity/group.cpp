@@ -1,10 +1,14 @@
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <functional>
+#include <span>
 #include <tuple>
 #include <utility>
 #include <gtest/gtest.h>
+#include <entt/core/hashed_string.hpp>
+#include <entt/core/job_system.hpp>
 #include <entt/entity/entity.hpp>
 #include <entt/entity/group.hpp>
 #include <entt/entity/mixin.hpp>
@@ -977,6 +981,127 @@ TEST(GroupOwning, Each) {
     }
 }
 
+TEST(GroupOwning, ParEach) {
+    entt::job_system jobs{4u};
+    entt::registry registry;
+    std::atomic<std::size_t> counter{};
+
+    auto group = registry.group<int, test::empty>(entt::get<char>, entt::exclude<double>);
+    auto cgroup = std::as_const(registry).group_if_exists<const int, const test::empty>(entt::get<const char>, entt::exclude<double>);
+
+    group.par_each(jobs, [&counter](int &, char &) { ++counter; });
+
+    ASSERT_EQ(counter, 0u);
+
+    for(std::size_t pos{}; pos < 3u * ENTT_PACKED_PAGE + 7u; ++pos) {
+        const auto entt = registry.create();
+        registry.emplace<int>(entt, 0);
+        registry.emplace<test::empty>(entt);
+        registry.emplace<char>(entt, static_cast<char>(0));
+
+        if(pos % 5u == 0u) {
+            registry.emplace<double>(entt);
+        }
+    }
+
+    group.par_each(jobs, [&counter](const auto entt, int &ivalue, char &cvalue) {
+        ivalue = static_cast<int>(entt::to_integral(entt));
+        cvalue = 1;
+        ++counter;
+    });
+
+    ASSERT_EQ(counter, group.size());
+
+    cgroup.par_each(jobs, [&counter](const int &, const char &cvalue) {
+        ASSERT_EQ(cvalue, 1);
+        --counter;
+    });
+
+    ASSERT_EQ(counter, 0u);
+
+    for(auto [entt, ivalue, cvalue]: group.each()) {
+        ASSERT_EQ(static_cast<int>(entt::to_integral(entt)), ivalue);
+    }
+}
+
+TEST(GroupOwning, Chunks) {
+    entt::registry registry;
+    auto group = registry.group<int, test::empty>(entt::get<char>);
+    auto cgroup = std::as_const(registry).group_if_exists<const int, const test::empty>(entt::get<const char>);
+
+    ASSERT_EQ(group.chunks(8u).begin(), group.chunks(8u).end());
+    const entt::basic_group<entt::owned_t<entt::storage<int>>, entt::get_t<>, entt::exclude_t<>> invalid{};
+
+    ASSERT_EQ(invalid.chunks(8u).begin(), invalid.chunks(8u).end());
+
+    for(std::size_t pos{}; pos < ENTT_PACKED_PAGE + 5u; ++pos) {
+        const auto entt = registry.create();
+        registry.emplace<int>(entt, static_cast<int>(entt::to_integral(entt)));
+        registry.emplace<test::empty>(entt);
+        registry.emplace<char>(entt);
+    }
+
+    testing::StaticAssertTypeEq<decltype(*group.chunks(1u).begin()), std::tuple<std::span<const entt::entity>, std::span<int>>>();
+    testing::StaticAssertTypeEq<decltype(*cgroup.chunks(1u).begin()), std::tuple<std::span<const entt::entity>, std::span<const int>>>();
+
+    std::size_t count{};
+    std::size_t total{};
+
+    for(auto [entities, values]: group.chunks(ENTT_PACKED_PAGE / 2u + 1u)) {
+        ASSERT_EQ(entities.size(), values.size());
+        ASSERT_LE(entities.size(), ENTT_PACKED_PAGE / 2u + 1u);
+
+        for(std::size_t pos{}; pos < entities.size(); ++pos) {
+            ASSERT_TRUE(group.contains(entities[pos]));
+            ASSERT_EQ(&values[pos], &group.get<int>(entities[pos]));
+        }
+
+        total += entities.size();
+        ++count;
+    }
+
+    // chunks do not cross the first page
+    ASSERT_EQ(count, 3u);
+    ASSERT_EQ(total, group.size());
+}
+
+TEST(GroupOwning, ChunksColumns) {
+    struct columnar {
+        int value{};
+        char other{};
+
+        using columns = entt::value_list<&columnar::value, &columnar::other>;
+    };
+
+    entt::registry registry;
+    const auto group = registry.group<columnar>();
+
+    for(std::size_t pos{}; pos < ENTT_PACKED_PAGE + 5u; ++pos) {
+        const auto entt = registry.create();
+        registry.emplace<columnar>(entt, static_cast<int>(entt::to_integral(entt)), 'c');
+    }
+
+    testing::StaticAssertTypeEq<decltype(*group.chunks(1u).begin()), std::tuple<std::span<const entt::entity>, std::tuple<std::span<int>, std::span<char>>>>();
+
+    std::size_t total{};
+
+    for(auto [entities, columns]: group.chunks(ENTT_PACKED_PAGE)) {
+        const auto [value, other] = columns;
+
+        ASSERT_EQ(entities.size(), value.size());
+        ASSERT_EQ(entities.size(), other.size());
+
+        for(std::size_t pos{}; pos < entities.size(); ++pos) {
+            ASSERT_EQ(value[pos], static_cast<int>(entt::to_integral(entities[pos])));
+            ASSERT_EQ(&other[pos], &group.get<columnar>(entities[pos]).get<&columnar::other>());
+        }
+
+        total += entities.size();
+    }
+
+    ASSERT_EQ(total, group.size());
+}
+
 TEST(GroupOwning, SortOrdered) {
     entt::registry registry;
     auto group = registry.group<test::boxed_int, char>();
@@ -1620,11 +1745,260 @@ TEST(GroupOwning, Storage) {
     ASSERT_EQ(group.storage<const float>(), nullptr);
 }
 
+TEST(GroupOwning, Nested) {
+    entt::registry registry;
+    std::array<entt::entity, 32u> entity{};
+
+    auto outer = registry.group<int, char>();
+    auto inner = registry.group<int, char, double>(entt::get<float>, entt::exclude<unsigned int>);
+    auto middle = registry.group<int, char>(entt::get<float>);
+
+    const auto check = [&]() {
+        std::size_t expected[3u]{};
+
+        for(auto entt: entity) {
+            const bool in_outer = registry.all_of<int, char>(entt);
+            const bool in_middle = in_outer && registry.all_of<float>(entt);
+            const bool in_inner = in_middle && registry.all_of<double>(entt) && !registry.all_of<unsigned int>(entt);
+
+            ASSERT_EQ(outer.contains(entt), in_outer);
+            ASSERT_EQ(middle.contains(entt), in_middle);
+            ASSERT_EQ(inner.contains(entt), in_inner);
+
+            expected[0u] += in_outer;
+            expected[1u] += in_middle;
+            expected[2u] += in_inner;
+        }
+
+        ASSERT_EQ(outer.size(), expected[0u]);
+        ASSERT_EQ(middle.size(), expected[1u]);
+        ASSERT_EQ(inner.size(), expected[2u]);
+
+        inner.each([](const auto entt, int ivalue, char cvalue, double dvalue, float fvalue) {
+            ASSERT_EQ(ivalue, static_cast<int>(entt::to_integral(entt)));
+            ASSERT_EQ(cvalue, static_cast<char>(ivalue));
+            ASSERT_EQ(dvalue, static_cast<double>(ivalue));
+            ASSERT_EQ(fvalue, static_cast<float>(ivalue));
+        });
+
+        outer.each([](const auto entt, int ivalue, char cvalue) {
+            ASSERT_EQ(ivalue, static_cast<int>(entt::to_integral(entt)));
+            ASSERT_EQ(cvalue, static_cast<char>(ivalue));
+        });
+    };
+
+    registry.create(entity.begin(), entity.end());
+
+    for(std::uint32_t next{}, seed{1u}; next < entity.size() * 16u; ++next) {
+        seed = seed * 1664525u + 1013904223u;
+        const auto entt = entity[(seed >> 8u) % entity.size()];
+        const auto value = static_cast<int>(entt::to_integral(entt));
+
+        switch((seed >> 16u) % 10u) {
+        case 0u:
+            registry.emplace_or_replace<int>(entt, value);
+            break;
+        case 1u:
+            registry.emplace_or_replace<char>(entt, static_cast<char>(value));
+            break;
+        case 2u:
+            registry.emplace_or_replace<double>(entt, static_cast<double>(value));
+            break;
+        case 3u:
+            registry.emplace_or_replace<float>(entt, static_cast<float>(value));
+            break;
+        case 4u:
+            (seed % 4u) ? registry.remove<unsigned int>(entt) : (registry.emplace_or_replace<unsigned int>(entt), 0u);
+            break;
+        case 5u:
+            registry.remove<int, char, double, float>(entt);
+            break;
+        case 6u:
+            registry.remove<float>(entt);
+            break;
+        default:
+            registry.emplace_or_replace<int>(entt, value);
+            registry.emplace_or_replace<char>(entt, static_cast<char>(value));
+            break;
+        }
+
+        check();
+    }
+
+    ASSERT_FALSE(outer.sortable());
+    ASSERT_FALSE(middle.sortable());
+    ASSERT_TRUE(inner.sortable());
+
+    inner.sort([](const entt::entity lhs, const entt::entity rhs) { return lhs > rhs; });
+    check();
+
+    registry.destroy(entity.begin(), entity.end());
+    check();
+
+    ASSERT_TRUE(outer.empty());
+}
+
 ENTT_DEBUG_TEST(GroupOwningDeathTest, Overlapping) {
     entt::registry registry;
     registry.group<char>(entt::get<int>, entt::exclude<double>);
 
     ASSERT_DEATH((registry.group<char, float>(entt::get<float>, entt::exclude<double>)), "");
-    ASSERT_DEATH(registry.group<char>(entt::get<int, float>, entt::exclude<double>), "");
-    ASSERT_DEATH(registry.group<char>(entt::get<int>, entt::exclude<double, float>), "");
+    ASSERT_DEATH(registry.group<char>(entt::get<float>, entt::exclude<double>), "");
+    ASSERT_DEATH(registry.group<char>(entt::get<int>, entt::exclude<float>), "");
+}
+
+ENTT_DEBUG_TEST(GroupOwningDeathTest, Nested) {
+    entt::registry registry;
+    auto group = registry.group<int>(entt::get<char>);
+    registry.group<int, double>(entt::get<char>);
+
+    ASSERT_DEATH(group.sort([](const entt::entity lhs, const entt::entity rhs) { return lhs < rhs; }), "");
+}
+
+TEST(GroupRuntime, NonOwning) {
+    entt::registry registry;
+    const std::array entity{registry.create(), registry.create(), registry.create()};
+    const std::array get{entt::type_hash<int>::value(), entt::type_hash<char>::value()};
+
+    registry.emplace<int>(entity[0u]);
+    registry.emplace<char>(entity[0u]);
+    registry.emplace<int>(entity[1u]);
+
+    auto group = registry.runtime_group({}, get);
+
+    ASSERT_TRUE(group);
+    ASSERT_EQ(group.size(), 1u);
+    ASSERT_TRUE(group.contains(entity[0u]));
+    ASSERT_FALSE(group.contains(entity[1u]));
+    ASSERT_EQ(group.storage(0u), &registry.storage<int>());
+    ASSERT_EQ(group.storage(1u), &registry.storage<char>());
+    ASSERT_EQ(group.storage(2u), nullptr);
+
+    registry.emplace<char>(entity[1u]);
+    registry.emplace<char>(entity[2u]);
+
+    ASSERT_EQ(group.size(), 2u);
+    ASSERT_EQ(group.front(), entity[1u]);
+    ASSERT_EQ(group.back(), entity[0u]);
+    ASSERT_EQ(*group.find(entity[1u]), entity[1u]);
+    ASSERT_EQ(group.find(entity[2u]), group.end());
+
+    registry.erase<int>(entity[0u]);
+
+    std::size_t count{};
+    group.each([&](const auto entt) { ASSERT_EQ(entt, entity[1u]); ++count; });
+
+    ASSERT_EQ(count, 1u);
+    ASSERT_EQ(registry.runtime_group({}, get).handle().data(), group.handle().data());
+}
+
+TEST(GroupRuntime, Owning) {
+    entt::registry registry;
+    const std::array entity{registry.create(), registry.create(), registry.create()};
+    const std::array owned{entt::type_hash<int>::value()};
+    const std::array get{entt::type_hash<char>::value()};
+    const std::array exclude{entt::type_hash<double>::value()};
+
+    registry.emplace<int>(entity[0u], 0);
+    registry.emplace<int>(entity[1u], 1);
+    registry.emplace<int>(entity[2u], 2);
+    registry.emplace<char>(entity[0u]);
+    registry.emplace<char>(entity[2u]);
+    registry.emplace<double>(entity[2u]);
+
+    auto group = registry.runtime_group(owned, get, exclude);
+
+    ASSERT_EQ(group.size(), 1u);
+    ASSERT_EQ(group.front(), entity[0u]);
+    ASSERT_EQ(registry.storage<int>().index(entity[0u]), 0u);
+    ASSERT_TRUE(registry.owned<int>());
+    ASSERT_FALSE(registry.owned<char>());
+
+    registry.erase<double>(entity[2u]);
+    registry.emplace<char>(entity[1u]);
+
+    ASSERT_EQ(group.size(), 3u);
+
+    registry.emplace<double>(entity[0u]);
+
+    ASSERT_EQ(group.size(), 2u);
+    ASSERT_FALSE(group.contains(entity[0u]));
+
+    for(auto entt: group) {
+        ASSERT_LT(registry.storage<int>().index(entt), group.size());
+        ASSERT_EQ(registry.get<int>(entt), static_cast<int>(entt::to_entity(entt)));
+    }
+
+    ASSERT_EQ(registry.storage<int>().index(entity[0u]), 2u);
+    ASSERT_FALSE(std::as_const(registry).runtime_group_if_exists(owned));
+    ASSERT_TRUE(std::as_const(registry).runtime_group_if_exists(owned, get, exclude));
+}
+
+TEST(GroupRuntime, Permutation) {
+    entt::registry registry;
+    const std::array owned{entt::type_hash<int>::value(), entt::type_hash<char>::value()};
+    const std::array other{entt::type_hash<char>::value(), entt::type_hash<int>::value()};
+    const std::array get{entt::type_hash<double>::value(), entt::type_hash<float>::value()};
+    const std::array reversed{entt::type_hash<float>::value(), entt::type_hash<double>::value()};
+
+    static_cast<void>(registry.storage<int>());
+    static_cast<void>(registry.storage<char>());
+    static_cast<void>(registry.storage<double>());
+    static_cast<void>(registry.storage<float>());
+
+    auto group = registry.runtime_group(owned, get);
+
+    ASSERT_EQ(registry.runtime_group(other, reversed).handle().data(), group.handle().data());
+    ASSERT_EQ(registry.runtime_group(owned, reversed).handle().data(), group.handle().data());
+    ASSERT_TRUE(std::as_const(registry).runtime_group_if_exists(other, get));
+    ASSERT_FALSE(std::as_const(registry).runtime_group_if_exists(other));
+    ASSERT_EQ(registry.runtime_group(other, reversed).storage(0u), &registry.storage<int>());
+}
+
+TEST(GroupRuntime, NamedStorage) {
+    using namespace entt::literals;
+
+    entt::registry registry;
+    const std::array entity{registry.create(), registry.create()};
+    const std::array<entt::id_type, 2u> owned{"a"_hs, "b"_hs};
+
+    // named storage of the same types are unrelated to the default ones
+    auto group = registry.group<int, char>();
+    auto &first = registry.storage<int>("a"_hs);
+    auto &second = registry.storage<char>("b"_hs);
+    auto named = registry.runtime_group(owned);
+
+    ASSERT_TRUE(registry.owned<int>());
+    ASSERT_TRUE(registry.owned<char>());
+
+    first.emplace(entity[0u]);
+    second.emplace(entity[0u]);
+    registry.emplace<int>(entity[1u]);
+    registry.emplace<char>(entity[1u]);
+
+    ASSERT_EQ(named.size(), 1u);
+    ASSERT_EQ(named.front(), entity[0u]);
+    ASSERT_EQ(group.size(), 1u);
+    ASSERT_EQ(group.front(), entity[1u]);
+
+    second.erase(entity[0u]);
+    registry.erase<int>(entity[1u]);
+
+    ASSERT_TRUE(named.empty());
+    ASSERT_TRUE(group.empty());
+}
+
+ENTT_DEBUG_TEST(GroupRuntimeDeathTest, Invalid) {
+    entt::registry registry;
+    const std::array owned{entt::type_hash<int>::value()};
+    const std::array get{entt::type_hash<char>::value()};
+    const std::array unknown{entt::type_hash<double>::value()};
+
+    static_cast<void>(registry.storage<int>());
+    static_cast<void>(registry.storage<char>());
+    static_cast<void>(registry.runtime_group(owned, get));
+
+    ASSERT_DEATH(static_cast<void>(registry.runtime_group(owned, {}, get)), "");
+    ASSERT_DEATH(static_cast<void>(registry.runtime_group(unknown)), "");
+    ASSERT_DEATH(static_cast<void>(registry.group<int>(entt::get<>, entt::exclude<char>)), "");
 }
@@ -34,6 +34,11 @@ using ToEntityTypes = ::testing::Types<int, test::pointer_stable>;
 TYPED_TEST_SUITE(ToEntity, ToEntityTypes, );
 TYPED_TEST_SUITE(ToEntityDeprecated, ToEntityTypes, );
 
+struct unpaged {
+    static constexpr auto page_size = entt::no_pagination;
+    int value{};
+};
+
 struct SighHelper: testing::Test {
     static void sigh_callback(int &value) {
         ++value;
@@ -125,6 +130,30 @@ TYPED_TEST(ToEntity, Functionalities) {
     ASSERT_EQ(entt::to_entity(storage, storage.get(other)), other);
 }
 
+TEST(ToEntity, NoPagination) {
+    entt::registry registry;
+    const entt::entity null = entt::null;
+
+    auto &storage = registry.storage<unpaged>();
+    const unpaged value{4};
+
+    ASSERT_EQ(entt::to_entity(storage, value), null);
+
+    const auto entity = registry.create();
+    const auto other = registry.create();
+
+    storage.emplace(entity);
+    storage.emplace(other, value);
+
+    ASSERT_EQ(entt::to_entity(storage, storage.get(entity)), entity);
+    ASSERT_EQ(entt::to_entity(storage, storage.get(other)), other);
+
+    storage.erase(entity);
+
+    ASSERT_EQ(entt::to_entity(storage, storage.get(other)), other);
+    ASSERT_EQ(entt::to_entity(storage, value), null);
+}
+
 TEST_F(SighHelper, Functionalities) {
     using namespace entt::literals;
 
@@ -10,7 +10,10 @@
 #include <vector>
 #include <gtest/gtest.h>
 #include <entt/config/config.h>
+#include <entt/core/algorithm.hpp>
 #include <entt/core/hashed_string.hpp>
+#include <entt/core/job_system.hpp>
+#include <entt/core/memory.hpp>
 #include <entt/core/type_info.hpp>
 #include <entt/entity/entity.hpp>
 #include <entt/entity/group.hpp>
@@ -2186,14 +2189,36 @@ TEST_F(Registry, CleanPartialOwningGroupViewAfterRemoveAndClear) {
     ASSERT_EQ(group.size(), 0u);
 }
 
+TEST_F(Registry, NestedGroups) {
+    entt::registry registry{};
+    const std::array entity{registry.create(), registry.create()};
+    auto inner = registry.group<int, double>(entt::get<char>);
+
+    registry.insert<int>(entity.begin(), entity.end());
+    registry.insert<double>(entity.begin(), entity.end());
+    registry.emplace<char>(entity[1u]);
+
+    auto outer = registry.group<int>(entt::get<char>);
+    auto other = registry.group<int>();
+
+    ASSERT_EQ(other.size(), 2u);
+    ASSERT_EQ(outer.size(), 1u);
+    ASSERT_EQ(inner.size(), 1u);
+    ASSERT_TRUE(inner.contains(entity[1u]));
+
+    registry.remove<double>(entity[1u]);
+
+    ASSERT_EQ(other.size(), 2u);
+    ASSERT_EQ(outer.size(), 1u);
+    ASSERT_EQ(inner.size(), 0u);
+}
+
 ENTT_DEBUG_TEST_F(RegistryDeathTest, NestedGroups) {
     entt::registry registry{};
     registry.group<int, double>(entt::get<char>);
 
-    ASSERT_DEATH(registry.group<int>(entt::get<char>), "");
     ASSERT_DEATH(registry.group<int>(entt::get<char, double>), "");
     ASSERT_DEATH(registry.group<int>(entt::get<char>, entt::exclude<double>), "");
-    ASSERT_DEATH((registry.group<int, double>()), "");
 }
 
 ENTT_DEBUG_TEST_F(RegistryDeathTest, ConflictingGroups) {
@@ -2287,6 +2312,41 @@ TEST_F(Registry, SortMulti) {
     }
 }
 
+TEST_F(Registry, ParSort) {
+    entt::job_system jobs{4u};
+    entt::registry registry{};
+
+    unsigned int uval = 0u;
+    int ival = 0;
+
+    for(auto i = 0; i < 3000; ++i) {
+        const auto entity = registry.create();
+        registry.emplace<unsigned int>(entity, uval++);
+        registry.emplace<int>(entity, ival++);
+    }
+
+    ASSERT_EQ(registry.get<unsigned int>(*registry.view<unsigned int>().begin()), --uval);
+    ASSERT_EQ(registry.get<int>(*registry.view<int>().begin()), --ival);
+
+    registry.par_sort<unsigned int>(jobs, std::less{}, entt::parallel_sort{}, jobs);
+    registry.par_sort<int, unsigned int>(jobs);
+
+    uval = 0u;
+    ival = 0;
+
+    for(auto entity: registry.view<unsigned int>()) {
+        ASSERT_EQ(registry.get<unsigned int>(entity), uval++);
+    }
+
+    for(auto entity: registry.view<int>()) {
+        ASSERT_EQ(registry.get<int>(entity), ival++);
+    }
+
+    for(auto [entity, value]: registry.view<unsigned int>().each()) {
+        ASSERT_EQ(static_cast<unsigned int>(registry.get<int>(entity)), value);
+    }
+}
+
 TEST_F(Registry, SortEmpty) {
     entt::registry registry{};
 
@@ -2578,3 +2638,84 @@ TEST_F(Registry, NoEtoType) {
 
     ASSERT_EQ((std::get<0>(view.get<no_eto_type, int>(entity))), (std::get<0>(cview.get<const no_eto_type, const int>(entity))));
 }
+
+TEST_F(Registry, PageAllocator) {
+    using registry_type = entt::basic_registry<entt::entity, entt::page_allocator<entt::entity>>;
+
+    entt::page_pool pool{};
+    registry_type registry{entt::page_allocator<entt::entity>{pool}};
+    std::array<entt::entity, 3u> entity{};
+
+    registry.create(entity.begin(), entity.end());
+    registry.insert<int>(entity.begin(), entity.end());
+    registry.emplace<char>(entity[0u], 'c');
+
+    ASSERT_EQ(&registry.storage<int>().get_allocator().resource(), &pool);
+    ASSERT_EQ(&registry.storage<char>().get_allocator().resource(), &pool);
+
+    const auto before = pool.cached();
+
+    registry.clear<int, char>();
+    registry.storage<int>().shrink_to_fit();
+
+    const auto cached = pool.cached();
+
+    ASSERT_GT(cached, before);
+
+    registry.insert<int>(entity.begin(), entity.end());
+
+    ASSERT_LT(pool.cached(), cached);
+}
+
+template<typename Type>
+struct counting_allocator: std::allocator<Type> {
+    using value_type = Type;
+
+    counting_allocator(std::size_t &ref)
+        : counter{&ref} {}
+
+    template<typename Other>
+    counting_allocator(const counting_allocator<Other> &other)
+        : counter{other.counter} {}
+
+    [[nodiscard]] Type *allocate(const std::size_t length) {
+        ++*counter;
+        return std::allocator<Type>::allocate(length);
+    }
+
+    template<typename Other>
+    [[nodiscard]] bool operator==(const counting_allocator<Other> &other) const noexcept {
+        return counter == other.counter;
+    }
+
+    std::size_t *counter;
+};
+
+TEST_F(Registry, Reserve) {
+    using registry_type = entt::basic_registry<entt::entity, counting_allocator<entt::entity>>;
+    using traits_type = entt::entt_traits<entt::entity>;
+
+    std::size_t counter{};
+    registry_type registry{counting_allocator<entt::entity>{counter}};
+    constexpr auto cap = traits_type::page_size + 1u;
+
+    registry.storage<int>();
+    registry.storage<char>();
+    registry.group(entt::get<int, char>);
+    registry.reserve(cap);
+
+    ASSERT_GE(registry.storage<entt::entity>().capacity(), cap);
+    ASSERT_GE(registry.storage<int>().capacity(), cap);
+    ASSERT_GE(registry.storage<int>().extent(), cap);
+
+    counter = 0u;
+
+    for(std::size_t pos{}; pos < cap; ++pos) {
+        const auto entity = registry.create();
+        registry.emplace<int>(entity, static_cast<int>(pos));
+        registry.emplace<char>(entity, 'c');
+    }
+
+    ASSERT_EQ(counter, 0u);
+    ASSERT_EQ(registry.group(entt::get<int, char>).size(), cap);
+}
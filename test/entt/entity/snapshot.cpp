@@ -1,4 +1,6 @@
 #include <array>
+#include <cstddef>
+#include <functional>
 #include <iterator>
 #include <type_traits>
 #include <utility>
@@ -6,6 +8,7 @@
 #include <gtest/gtest.h>
 #include <entt/core/any.hpp>
 #include <entt/core/hashed_string.hpp>
+#include <entt/core/job_system.hpp>
 #include <entt/entity/entity.hpp>
 #include <entt/entity/mixin.hpp>
 #include <entt/entity/registry.hpp>
@@ -14,6 +17,16 @@
 #include "../../common/config.h"
 #include "../../common/value_type.h"
 
+struct input_archive {
+    template<typename Type>
+    void operator()(Type &elem) {
+        elem = entt::any_cast<Type>((*data)[pos++]);
+    }
+
+    const std::vector<entt::any> *data{};
+    std::size_t pos{};
+};
+
 struct SnapshotCommonBase: testing::Test {
     struct shadow {
         entt::entity target{entt::null};
@@ -278,6 +291,44 @@ TEST_F(BasicSnapshot, GetTypeSparse) {
     ASSERT_EQ(entt::any_cast<int>(data[5u]), value[2u]);
 }
 
+TEST_F(BasicSnapshot, ParGet) {
+    using traits_type = entt::entt_traits<entt::entity>;
+
+    entt::job_system jobs{2u};
+    entt::registry registry;
+    const entt::basic_snapshot snapshot{registry};
+    constexpr auto number_of_entities = 3u;
+
+    std::array<entt::entity, number_of_entities> entity{};
+    const std::array value{1, 2, 3};
+
+    registry.create(entity.begin(), entity.end());
+    registry.insert<int>(entity.begin(), entity.end(), value.begin());
+    registry.emplace<char>(entity[1u], 'c');
+    registry.emplace<test::empty>(entity[2u]);
+
+    std::array<std::vector<entt::any>, 3u> data{};
+    std::array<std::function<void(entt::any)>, 3u> archive{};
+
+    for(std::size_t pos{}; pos < archive.size(); ++pos) {
+        archive[pos] = [&elem = data[pos]](entt::any other) { elem.emplace_back(std::move(other)); };
+    }
+
+    snapshot.par_get<int, char, test::empty>(jobs, archive.begin());
+
+    ASSERT_EQ(data[0u].size(), 7u);
+    ASSERT_EQ(data[1u].size(), 3u);
+    ASSERT_EQ(data[2u].size(), 2u);
+
+    ASSERT_EQ(entt::any_cast<traits_type::entity_type>(data[0u][0u]), number_of_entities);
+    ASSERT_EQ(entt::any_cast<traits_type::entity_type>(data[1u][0u]), 1u);
+    ASSERT_EQ(entt::any_cast<traits_type::entity_type>(data[2u][0u]), 1u);
+
+    ASSERT_EQ(entt::any_cast<entt::entity>(data[1u][1u]), entity[1u]);
+    ASSERT_EQ(entt::any_cast<char>(data[1u][2u]), 'c');
+    ASSERT_EQ(entt::any_cast<entt::entity>(data[2u][1u]), entity[2u]);
+}
+
 TEST_F(BasicSnapshotLoader, Constructors) {
     static_assert(!std::is_default_constructible_v<entt::basic_snapshot_loader<entt::registry>>, "Default constructible type not allowed");
     static_assert(!std::is_copy_constructible_v<entt::basic_snapshot_loader<entt::registry>>, "Copy constructible type not allowed");
@@ -559,6 +610,51 @@ TEST_F(BasicSnapshotLoader, Orphans) {
     ASSERT_FALSE(registry.valid(entity[1u]));
 }
 
+TEST_F(BasicSnapshotLoader, ParGet) {
+    entt::job_system jobs{2u};
+    entt::registry source;
+    entt::registry registry;
+    std::array<entt::entity, 3u> entity{};
+
+    source.create(entity.begin(), entity.end());
+    source.destroy(entity[0u]);
+    source.emplace<int>(entity[1u], 1);
+    source.emplace<int>(entity[2u], 2);
+    source.emplace<char>(entity[2u], 'c');
+
+    std::array<std::vector<entt::any>, 3u> data{};
+    std::array<std::function<void(entt::any)>, 3u> output{};
+
+    for(std::size_t pos{}; pos < output.size(); ++pos) {
+        output[pos] = [&elem = data[pos]](entt::any value) { elem.emplace_back(std::move(value)); };
+    }
+
+    entt::snapshot{source}
+        .get<entt::entity>(output[0u])
+        .par_get<int, char>(jobs, std::next(output.begin()));
+
+    std::array<input_archive, 3u> input{};
+
+    for(std::size_t pos{}; pos < input.size(); ++pos) {
+        input[pos].data = &data[pos];
+    }
+
+    entt::basic_snapshot_loader loader{registry};
+
+    loader
+        .get<entt::entity>(input[0u])
+        .par_get<int, char>(jobs, std::next(input.begin()));
+
+    ASSERT_FALSE(registry.valid(entity[0u]));
+    ASSERT_TRUE(registry.valid(entity[1u]));
+    ASSERT_TRUE(registry.valid(entity[2u]));
+
+    ASSERT_EQ(registry.get<int>(entity[1u]), 1);
+    ASSERT_EQ(registry.get<int>(entity[2u]), 2);
+    ASSERT_EQ(registry.get<char>(entity[2u]), 'c');
+    ASSERT_FALSE(registry.all_of<char>(entity[1u]));
+}
+
 TEST_F(BasicContinuousLoader, Constructors) {
     static_assert(!std::is_default_constructible_v<entt::basic_continuous_loader<entt::registry>>, "Default constructible type not allowed");
     static_assert(!std::is_copy_constructible_v<entt::basic_continuous_loader<entt::registry>>, "Copy constructible type not allowed");
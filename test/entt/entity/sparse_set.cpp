@@ -8,6 +8,8 @@
 #include <utility>
 #include <gtest/gtest.h>
 #include <entt/config/config.h>
+#include <entt/core/algorithm.hpp>
+#include <entt/core/job_system.hpp>
 #include <entt/core/type_info.hpp>
 #include <entt/entity/entity.hpp>
 #include <entt/entity/sparse_set.hpp>
@@ -290,6 +292,35 @@ TYPED_TEST(SparseSet, Capacity) {
     }
 }
 
+TYPED_TEST(SparseSet, ReserveExtent) {
+    using entity_type = TestFixture::type;
+    using sparse_set_type = entt::basic_sparse_set<entity_type>;
+    using traits_type = entt::entt_traits<entity_type>;
+
+    for(const auto policy: this->deletion_policy) {
+        sparse_set_type set{policy};
+
+        set.reserve_extent(0u);
+
+        ASSERT_EQ(set.extent(), 0u);
+
+        set.reserve_extent(traits_type::page_size + 1u);
+
+        ASSERT_EQ(set.extent(), 2 * traits_type::page_size);
+        ASSERT_TRUE(set.empty());
+
+        set.reserve_extent(1u);
+
+        ASSERT_EQ(set.extent(), 2 * traits_type::page_size);
+
+        set.push(entity_type{traits_type::page_size});
+
+        ASSERT_EQ(set.extent(), 2 * traits_type::page_size);
+        ASSERT_TRUE(set.contains(entity_type{traits_type::page_size}));
+        ASSERT_FALSE(set.contains(entity_type{0u}));
+    }
+}
+
 TYPED_TEST(SparseSet, ShrinkToFit) {
     using entity_type = TestFixture::type;
     using sparse_set_type = entt::basic_sparse_set<entity_type>;
@@ -918,6 +949,32 @@ TYPED_TEST(SparseSet, Current) {
     }
 }
 
+TYPED_TEST(SparseSet, Prefetch) {
+    using entity_type = TestFixture::type;
+    using sparse_set_type = entt::basic_sparse_set<entity_type>;
+    using traits_type = entt::entt_traits<entity_type>;
+
+    for(const auto policy: this->deletion_policy) {
+        sparse_set_type set{policy};
+        const entity_type entity{traits_type::construct(0, 0)};
+        const entity_type other{traits_type::construct(traits_type::page_size, 0)};
+
+        // hints only, unknown entities are fine too
+        set.prefetch(entity);
+        set.prefetch(entt::null);
+        set.prefetch(entt::tombstone);
+
+        set.push(entity);
+        set.prefetch(entity);
+        set.prefetch(other);
+
+        ASSERT_TRUE(set.contains(entity));
+        ASSERT_FALSE(set.contains(other));
+        ASSERT_EQ(set.size(), 1u);
+        ASSERT_EQ(set.extent(), traits_type::page_size);
+    }
+}
+
 TYPED_TEST(SparseSet, CurrentErased) {
     using entity_type = TestFixture::type;
     using sparse_set_type = entt::basic_sparse_set<entity_type>;
@@ -1918,6 +1975,77 @@ TYPED_TEST(SparseSet, SortN) {
     }
 }
 
+TYPED_TEST(SparseSet, ParSort) {
+    using entity_type = TestFixture::type;
+    using traits_type = entt::entt_traits<entity_type>;
+    using sparse_set_type = entt::basic_sparse_set<entity_type>;
+
+    entt::job_system jobs{4u};
+
+    for(const auto policy: this->deletion_policy) {
+        sparse_set_type set{policy};
+
+        for(std::size_t pos{}; pos < 3000u; ++pos) {
+            set.push(traits_type::construct(static_cast<traits_type::entity_type>((pos * 7919u) % 3000u), {}));
+        }
+
+        set.par_sort_n(jobs, 1500u, std::less{});
+
+        for(std::size_t pos{}; pos < set.size(); ++pos) {
+            ASSERT_EQ(set.index(set.data()[pos]), pos);
+        }
+
+        for(std::size_t pos{1u}; pos < 1500u; ++pos) {
+            ASSERT_LT(set.data()[pos], set.data()[pos - 1u]);
+        }
+
+        set.par_sort(jobs, std::less{}, entt::parallel_sort{}, jobs);
+
+        ASSERT_TRUE(std::is_sorted(set.begin(), set.end()));
+
+        for(std::size_t pos{}; pos < set.size(); ++pos) {
+            ASSERT_EQ(set.index(set.data()[pos]), pos);
+        }
+    }
+}
+
+TYPED_TEST(SparseSet, ParSortAs) {
+    using entity_type = TestFixture::type;
+    using sparse_set_type = entt::basic_sparse_set<entity_type>;
+
+    entt::job_system jobs{4u};
+
+    for(const auto policy: this->deletion_policy) {
+        sparse_set_type lhs{policy};
+        sparse_set_type rhs{policy};
+
+        std::array lhs_entity{entity_type{1}, entity_type{2}, entity_type{4}, entity_type{8}, entity_type{16}};
+        std::array rhs_entity{entity_type{4}, entity_type{2}, entity_type{32}, entity_type{1}, entity_type{8}, entity_type{16}};
+
+        lhs.push(lhs_entity.begin(), lhs_entity.end());
+        rhs.push(rhs_entity.begin(), rhs_entity.end());
+
+        const auto it = rhs.par_sort_as(jobs, lhs.begin(), lhs.end());
+
+        ASSERT_EQ(it, rhs.begin() + lhs_entity.size());
+
+        auto begin = rhs.begin();
+        const auto end = rhs.end();
+
+        ASSERT_EQ(*(begin++), rhs_entity[5u]);
+        ASSERT_EQ(*(begin++), rhs_entity[4u]);
+        ASSERT_EQ(*(begin++), rhs_entity[0u]);
+        ASSERT_EQ(*(begin++), rhs_entity[1u]);
+        ASSERT_EQ(*(begin++), rhs_entity[3u]);
+        ASSERT_EQ(*(begin++), rhs_entity[2u]);
+        ASSERT_EQ(begin, end);
+
+        for(std::size_t pos{}; pos < rhs.size(); ++pos) {
+            ASSERT_EQ(rhs.index(rhs.data()[pos]), pos);
+        }
+    }
+}
+
 ENTT_DEBUG_TYPED_TEST(SparseSetDeathTest, SortN) {
     using entity_type = TestFixture::type;
     using sparse_set_type = entt::basic_sparse_set<entity_type>;
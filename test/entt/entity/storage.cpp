@@ -1,13 +1,18 @@
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <cstdint>
+#include <iterator>
 #include <memory>
+#include <string>
 #include <tuple>
 #include <type_traits>
 #include <unordered_set>
 #include <utility>
 #include <gtest/gtest.h>
+#include <entt/core/algorithm.hpp>
 #include <entt/core/iterator.hpp>
+#include <entt/core/job_system.hpp>
 #include <entt/core/type_info.hpp>
 #include <entt/entity/component.hpp>
 #include <entt/entity/entity.hpp>
@@ -61,6 +66,54 @@ struct StorageBase: testing::Test {
 
         my_entity child;
     };
+
+    struct columnar {
+        int value{};
+        std::string name{};
+
+        using columns = entt::value_list<&columnar::value, &columnar::name>;
+    };
+
+    struct hot_cold {
+        struct {
+            int value{};
+        } hot{};
+
+        struct {
+            std::array<char, 256u> buffer{};
+        } cold{};
+
+        using columns = entt::value_list<&hot_cold::hot, &hot_cold::cold>;
+    };
+
+    struct unpaged {
+        static constexpr auto page_size = entt::no_pagination;
+        int value{};
+    };
+
+    struct unpaged_allocator_aware {
+        static constexpr auto page_size = entt::no_pagination;
+        using allocator_type = std::allocator<unpaged_allocator_aware>;
+
+        unpaged_allocator_aware() = default;
+
+        unpaged_allocator_aware(std::allocator_arg_t, const allocator_type &, int elem = 0)
+            : value{elem},
+              aware{true} {}
+
+        unpaged_allocator_aware(std::allocator_arg_t, const allocator_type &, const unpaged_allocator_aware &other)
+            : value{other.value},
+              aware{true} {}
+
+        int value{};
+        bool aware{};
+    };
+
+    struct over_aligned {
+        static constexpr auto page_size = 4u;
+        static constexpr auto page_alignment = 64u;
+        float value[4u]{};
+    };
 };
 
 template<>
@@ -1655,6 +1708,77 @@ TYPED_TEST(Storage, SortAsUnordered) {
     ASSERT_EQ(rhs.data()[5u], rhs_entity[5u]);
 }
 
+TYPED_TEST(Storage, ParSort) {
+    using value_type = TestFixture::type;
+    using entity_type = TestFixture::my_entity;
+    using traits_type = entt::entt_traits<entity_type>;
+
+    entt::job_system jobs{4u};
+    entt::basic_storage<value_type, entity_type> pool;
+
+    for(std::size_t pos{}; pos < 3000u; ++pos) {
+        pool.emplace(traits_type::construct(static_cast<traits_type::entity_type>(pos), {}), static_cast<int>((pos * 7919u) % 3000u));
+    }
+
+    const auto compare = [&pool](auto lhs, auto rhs) { return pool.get(lhs) < pool.get(rhs); };
+    pool.par_sort_n(jobs, 1500u, compare);
+
+    for(std::size_t pos{}; pos < pool.size(); ++pos) {
+        ASSERT_EQ(pool.index(pool.data()[pos]), pos);
+        ASSERT_EQ(pool.get(pool.data()[pos]), value_type{static_cast<int>((entt::to_entity(pool.data()[pos]) * 7919u) % 3000u)});
+    }
+
+    for(std::size_t pos{1u}; pos < 1500u; ++pos) {
+        ASSERT_TRUE(compare(pool.data()[pos], pool.data()[pos - 1u]));
+    }
+
+    pool.par_sort(jobs, compare, entt::parallel_sort{}, jobs);
+
+    int value{};
+
+    for(auto &&elem: pool) {
+        ASSERT_EQ(elem, value_type{value++});
+    }
+
+    for(auto [entt, elem]: pool.each()) {
+        ASSERT_EQ(elem, value_type{static_cast<int>((entt::to_entity(entt) * 7919u) % 3000u)});
+    }
+}
+
+TYPED_TEST(Storage, ParSortAs) {
+    using value_type = TestFixture::type;
+    using entity_type = TestFixture::my_entity;
+
+    entt::job_system jobs{4u};
+    entt::basic_storage<value_type, entity_type> lhs;
+    entt::basic_storage<value_type, entity_type> rhs;
+    const std::array lhs_entity{entity_type{1}, entity_type{2}, entity_type{4}, entity_type{8}, entity_type{16}};
+    const std::array lhs_value{value_type{0}, value_type{1}, value_type{2}, value_type{4}, value_type{8}};
+
+    lhs.insert(lhs_entity.begin(), lhs_entity.end(), lhs_value.begin());
+
+    const std::array rhs_entity{entity_type{4}, entity_type{2}, entity_type{32}, entity_type{1}, entity_type{8}, entity_type{16}};
+    const std::array rhs_value{value_type{2}, value_type{1}, value_type{16}, value_type{0}, value_type{4}, value_type{8}};
+
+    rhs.insert(rhs_entity.begin(), rhs_entity.end(), rhs_value.begin());
+    rhs.par_sort_as(jobs, lhs.entt::template basic_sparse_set<entity_type>::begin(), lhs.entt::template basic_sparse_set<entity_type>::end());
+
+    auto begin = rhs.begin();
+    auto end = rhs.end();
+
+    ASSERT_EQ(*(begin++), rhs_value[5u]);
+    ASSERT_EQ(*(begin++), rhs_value[4u]);
+    ASSERT_EQ(*(begin++), rhs_value[0u]);
+    ASSERT_EQ(*(begin++), rhs_value[1u]);
+    ASSERT_EQ(*(begin++), rhs_value[3u]);
+    ASSERT_EQ(*(begin++), rhs_value[2u]);
+    ASSERT_EQ(begin, end);
+
+    for(std::size_t pos{}; pos < rhs_entity.size(); ++pos) {
+        ASSERT_EQ(rhs.get(rhs_entity[pos]), rhs_value[pos]);
+    }
+}
+
 TEST(Storage, MoveOnlyComponent) {
     using value_type = std::unique_ptr<int>;
     using entity_type = StorageBase::my_entity;
@@ -1957,6 +2081,310 @@ TEST(Storage, ThrowingComponent) {
     ASSERT_EQ(pool.get(entity[0u]), value[1u]);
 }
 
+TEST(Storage, Columns) {
+    using entity_type = StorageBase::my_entity;
+    using value_type = StorageBase::columnar;
+    using traits_type = entt::component_traits<value_type, entity_type>;
+
+    entt::basic_storage<value_type, entity_type> pool;
+    const std::array entity{entity_type{1}, entity_type{3}, entity_type{traits_type::page_size}};
+
+    testing::StaticAssertTypeEq<decltype(pool.emplace({})), decltype(pool)::reference>();
+    testing::StaticAssertTypeEq<decltype(std::as_const(pool).get({})), decltype(pool)::const_reference>();
+
+    ASSERT_EQ(pool.emplace(entity[0u]).get<&value_type::value>(), 0);
+    ASSERT_EQ(pool.emplace(entity[1u], 2, "foo").get<&value_type::name>(), "foo");
+    ASSERT_EQ(pool.emplace(entity[2u], value_type{4, "bar"}).get<&value_type::value>(), 4);
+
+    ASSERT_EQ(pool.size(), 3u);
+    ASSERT_EQ(pool.capacity(), traits_type::page_size);
+
+    pool.get(entity[0u]) = value_type{1, "quux"};
+    pool.patch(entity[1u], [](auto elem) { elem.template get<&value_type::value>() = 3; });
+
+    const value_type elem = std::as_const(pool).get(entity[0u]);
+
+    ASSERT_EQ(elem.value, 1);
+    ASSERT_EQ(elem.name, "quux");
+    ASSERT_EQ(pool.get(entity[1u]).get<&value_type::value>(), 3);
+    ASSERT_EQ(std::get<0>(pool.get_as_tuple(entity[2u])).get<&value_type::name>(), "bar");
+
+    pool.erase(entity[0u]);
+
+    ASSERT_EQ(pool.size(), 2u);
+    ASSERT_FALSE(pool.contains(entity[0u]));
+    ASSERT_EQ(pool.get(entity[1u]).get<&value_type::name>(), "foo");
+    ASSERT_EQ(pool.get(entity[2u]).get<&value_type::name>(), "bar");
+
+    for(auto [entt, value]: pool.each()) {
+        value.get<&value_type::value>() *= 2;
+    }
+
+    ASSERT_EQ(pool.get(entity[1u]).get<&value_type::value>(), 6);
+    ASSERT_EQ(pool.get(entity[2u]).get<&value_type::value>(), 8);
+
+    int sum{};
+
+    for(auto value: std::as_const(pool)) {
+        sum += value.get<&value_type::value>();
+    }
+
+    ASSERT_EQ(sum, 14);
+    ASSERT_EQ(pool.end() - pool.begin(), 2);
+    ASSERT_EQ(pool.rbegin()->get<&value_type::value>(), pool.get(pool.data()[0u]).get<&value_type::value>());
+
+    const int *column = pool.raw<&value_type::value>()[0u];
+
+    ASSERT_EQ(column[pool.index(entity[1u])], 6);
+    ASSERT_EQ(column[pool.index(entity[2u])], 8);
+
+    pool.clear();
+    pool.shrink_to_fit();
+
+    ASSERT_TRUE(pool.empty());
+    ASSERT_EQ(pool.capacity(), 0u);
+}
+
+TEST(Storage, ColumnsInsert) {
+    using entity_type = StorageBase::my_entity;
+    using value_type = StorageBase::columnar;
+
+    entt::basic_storage<value_type, entity_type> pool;
+    const std::array entity{entity_type{1}, entity_type{3}};
+    const std::array value{value_type{1, "foo"}, value_type{2, "bar"}};
+
+    pool.insert(entity.begin(), entity.end(), value[0u]);
+
+    ASSERT_EQ(pool.get(entity[1u]).get<&value_type::name>(), "foo");
+
+    pool.erase(entity.begin(), entity.end());
+    pool.insert(entity.rbegin(), entity.rend(), value.begin());
+
+    ASSERT_EQ(pool.get(entity[0u]).get<&value_type::value>(), 2);
+    ASSERT_EQ(pool.get(entity[1u]).get<&value_type::value>(), 1);
+
+    pool.swap_elements(entity[0u], entity[1u]);
+
+    ASSERT_EQ(pool.get(entity[0u]).get<&value_type::value>(), 2);
+    ASSERT_EQ(pool.index(entity[0u]), 0u);
+
+    entt::basic_storage<value_type, entity_type> other{std::move(pool)};
+
+    ASSERT_EQ(other.size(), 2u);
+    ASSERT_EQ(other.get(entity[1u]).get<&value_type::name>(), "foo");
+
+    auto &base = static_cast<entt::basic_sparse_set<entity_type> &>(other);
+    const value_type instance{3, "quux"};
+
+    base.push(entity_type{5}, &instance);
+
+    ASSERT_EQ(other.get(entity_type{5}).get<&value_type::name>(), "quux");
+}
+
+TEST(Storage, ColumnsEach) {
+    using entity_type = StorageBase::my_entity;
+    using value_type = StorageBase::hot_cold;
+
+    entt::basic_storage<value_type, entity_type> pool;
+    const std::array entity{entity_type{1}, entity_type{3}, entity_type{5}};
+
+    for(auto entt: entity) {
+        auto elem = pool.emplace(entt);
+        elem.get<&value_type::hot>().value = static_cast<int>(entt::to_integral(entt));
+        elem.get<&value_type::cold>().buffer[0u] = 'c';
+    }
+
+    pool.erase(entity[0u]);
+
+    ASSERT_EQ(pool.get(entity[2u]).get<&value_type::hot>().value, 5);
+
+    for(auto [entt, hot]: pool.each<&value_type::hot>()) {
+        testing::StaticAssertTypeEq<decltype(hot), decltype(value_type::hot) &>();
+        ASSERT_EQ(hot.value, static_cast<int>(entt::to_integral(entt)));
+        hot.value *= 2;
+    }
+
+    for(auto [entt, cold]: std::as_const(pool).each<&value_type::cold>()) {
+        testing::StaticAssertTypeEq<decltype(cold), const decltype(value_type::cold) &>();
+        ASSERT_TRUE(pool.contains(entt));
+        ASSERT_EQ(cold.buffer[0u], 'c');
+    }
+
+    ASSERT_EQ(pool.get(entity[1u]).get<&value_type::hot>().value, 6);
+    ASSERT_EQ(pool.get(entity[2u]).get<&value_type::hot>().value, 10);
+    ASSERT_EQ(std::distance(pool.each<&value_type::cold>().begin(), pool.each<&value_type::cold>().end()), 2);
+}
+
+TEST(Storage, PageAlignment) {
+    using entity_type = StorageBase::my_entity;
+    using value_type = StorageBase::over_aligned;
+    using traits_type = entt::component_traits<value_type, entity_type>;
+
+    entt::basic_storage<value_type, entity_type> pool;
+
+    for(std::size_t pos{}; pos < 4u * traits_type::page_size; ++pos) {
+        pool.emplace(entity_type{static_cast<std::underlying_type_t<entity_type>>(pos)}).value[0u] = static_cast<float>(pos);
+    }
+
+    for(std::size_t pos{}, last = pool.capacity() / traits_type::page_size; pos < last; ++pos) {
+        ASSERT_EQ(reinterpret_cast<std::uintptr_t>(pool.raw()[pos]) % traits_type::page_alignment, 0u);
+    }
+
+    pool.erase(entity_type{0});
+    pool.shrink_to_fit();
+
+    ASSERT_EQ(pool.get(entity_type{1}).value[0u], 1.f);
+    ASSERT_EQ(pool.capacity(), 4u * traits_type::page_size);
+}
+
+TEST(Storage, NoPagination) {
+    using entity_type = StorageBase::my_entity;
+    using value_type = StorageBase::unpaged;
+
+    entt::basic_storage<value_type, entity_type> pool;
+    const std::array entity{entity_type{1}, entity_type{3}, entity_type{42}};
+
+    testing::StaticAssertTypeEq<decltype(pool.raw()), value_type *>();
+    testing::StaticAssertTypeEq<decltype(std::as_const(pool).raw()), const value_type *>();
+
+    ASSERT_EQ(pool.policy(), entt::deletion_policy::swap_and_pop);
+    ASSERT_EQ(pool.capacity(), 0u);
+
+    pool.reserve(2u);
+
+    ASSERT_EQ(pool.capacity(), 2u);
+
+    ASSERT_EQ(pool.emplace(entity[0u]).value, 0);
+    ASSERT_EQ(pool.emplace(entity[1u], 2).value, 2);
+    ASSERT_EQ(pool.emplace(entity[2u], value_type{4}).value, 4);
+
+    ASSERT_EQ(pool.size(), 3u);
+    ASSERT_GE(pool.capacity(), 3u);
+
+    pool.patch(entity[0u], [](auto &elem) { elem.value = 1; });
+
+    ASSERT_EQ(std::as_const(pool).get(entity[0u]).value, 1);
+    ASSERT_EQ(std::get<0>(pool.get_as_tuple(entity[1u])).value, 2);
+
+    for(std::size_t pos{}; pos < pool.size(); ++pos) {
+        ASSERT_EQ(&pool.raw()[pos], &pool.get(pool.data()[pos]));
+    }
+
+    pool.erase(entity[0u]);
+
+    ASSERT_EQ(pool.size(), 2u);
+    ASSERT_FALSE(pool.contains(entity[0u]));
+    ASSERT_EQ(pool.index(entity[2u]), 0u);
+    ASSERT_EQ(pool.get(entity[1u]).value, 2);
+    ASSERT_EQ(pool.get(entity[2u]).value, 4);
+
+    for(auto [entt, value]: pool.each()) {
+        value.value *= 2;
+    }
+
+    int sum{};
+
+    for(auto &&value: std::as_const(pool)) {
+        sum += value.value;
+    }
+
+    ASSERT_EQ(sum, 12);
+    ASSERT_EQ(pool.end() - pool.begin(), 2);
+    ASSERT_EQ(&*pool.begin(), &pool.get(pool.data()[1u]));
+    ASSERT_EQ(&*pool.rbegin(), pool.raw());
+
+    pool.swap_elements(entity[1u], entity[2u]);
+
+    ASSERT_EQ(pool.index(entity[1u]), 0u);
+    ASSERT_EQ(pool.raw()[0u].value, 4);
+
+    pool.clear();
+    pool.shrink_to_fit();
+
+    ASSERT_TRUE(pool.empty());
+    ASSERT_EQ(pool.capacity(), 0u);
+}
+
+TEST(Storage, NoPaginationInsert) {
+    using entity_type = StorageBase::my_entity;
+    using value_type = StorageBase::unpaged;
+
+    entt::basic_storage<value_type, entity_type> pool;
+    const std::array entity{entity_type{1}, entity_type{3}};
+    const std::array value{value_type{1}, value_type{2}};
+
+    pool.insert(entity.begin(), entity.end(), value[0u]);
+
+    ASSERT_EQ(pool.get(entity[1u]).value, 1);
+
+    pool.erase(entity.begin(), entity.end());
+    pool.insert(entity.rbegin(), entity.rend(), value.begin());
+
+    ASSERT_EQ(pool.get(entity[0u]).value, 2);
+    ASSERT_EQ(pool.get(entity[1u]).value, 1);
+
+    entt::basic_storage<value_type, entity_type> other{std::move(pool)};
+
+    ASSERT_EQ(other.size(), 2u);
+    ASSERT_EQ(other.get(entity[1u]).value, 1);
+
+    auto &base = static_cast<entt::basic_sparse_set<entity_type> &>(other);
+    const value_type instance{3};
+
+    base.push(entity_type{5}, &instance);
+
+    ASSERT_EQ(other.get(entity_type{5}).value, 3);
+    ASSERT_EQ(base.value(entity_type{5}), &other.get(entity_type{5}));
+}
+
+TEST(Storage, NoPaginationEmplaceDuringIteration) {
+    using entity_type = StorageBase::my_entity;
+    using value_type = StorageBase::unpaged;
+
+    entt::basic_storage<value_type, entity_type> pool;
+    std::size_t visited{};
+
+    for(std::size_t pos{}; pos < 4u; ++pos) {
+        pool.emplace(entity_type{static_cast<std::underlying_type_t<entity_type>>(pos)}, static_cast<int>(pos));
+    }
+
+    // iterators survive the reallocation of the underlying array
+    for(auto [entt, value]: pool.each()) {
+        ASSERT_EQ(value.value, static_cast<int>(entt::to_integral(entt)));
+
+        if(visited++ == 0u) {
+            // references to elements are invalidated instead
+            for(std::size_t pos{}; pos < 100u; ++pos) {
+                pool.emplace(entity_type{static_cast<std::underlying_type_t<entity_type>>(pos + 4u)});
+            }
+        }
+    }
+
+    ASSERT_EQ(visited, 4u);
+    ASSERT_EQ(pool.size(), 104u);
+    ASSERT_EQ(pool.cend() - pool.cbegin(), 104);
+    ASSERT_EQ(pool.rbegin()->value, 0);
+}
+
+TEST(Storage, NoPaginationUsesAllocatorConstruction) {
+    using entity_type = StorageBase::my_entity;
+    using value_type = StorageBase::unpaged_allocator_aware;
+
+    entt::basic_storage<value_type, entity_type> pool;
+    const std::array entity{entity_type{4}, entity_type{5}};
+    const value_type instance{};
+
+    ASSERT_TRUE(pool.emplace(entity_type{1}).aware);
+    ASSERT_EQ(pool.emplace(entity_type{3}, 2).value, 2);
+    ASSERT_TRUE(pool.get(entity_type{3}).aware);
+
+    pool.insert(entity.begin(), entity.end(), instance);
+
+    ASSERT_FALSE(instance.aware);
+    ASSERT_TRUE(pool.get(entity[0u]).aware);
+    ASSERT_TRUE(pool.get(entity[1u]).aware);
+}
+
 #if defined(ENTT_HAS_TRACKED_MEMORY_RESOURCE)
 
 TYPED_TEST(Storage, NoUsesAllocatorConstruction) {
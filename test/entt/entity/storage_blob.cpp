@@ -0,0 +1,229 @@
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/core/type_info.hpp>
+#include <entt/entity/component.hpp>
+#include <entt/entity/entity.hpp>
+#include <entt/entity/group.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/storage.hpp>
+#include <entt/entity/view.hpp>
+
+struct StorageBlob: testing::Test {
+    using blob_type = entt::blob_t<int>;
+
+    template<typename Type>
+    static std::vector<int> to_vector(const Type &span) {
+        return std::vector<int>(span.begin(), span.end());
+    }
+};
+
+TEST_F(StorageBlob, Constructors) {
+    entt::storage<blob_type> pool;
+
+    ASSERT_EQ(pool.policy(), entt::deletion_policy::swap_and_pop);
+    ASSERT_NO_THROW([[maybe_unused]] auto alloc = pool.get_allocator());
+    ASSERT_EQ(pool.info(), entt::type_id<blob_type>());
+
+    pool = entt::storage<blob_type>{std::allocator<blob_type>{}};
+
+    ASSERT_EQ(pool.policy(), entt::deletion_policy::swap_and_pop);
+    ASSERT_EQ(pool.info(), entt::type_id<blob_type>());
+}
+
+TEST_F(StorageBlob, Move) {
+    entt::storage<blob_type> pool;
+    const std::array entity{entt::entity{3}, entt::entity{2}};
+
+    pool.emplace(entity[0u], std::vector{1, 2, 3});
+
+    static_assert(std::is_move_constructible_v<decltype(pool)>, "Move constructible type required");
+    static_assert(std::is_move_assignable_v<decltype(pool)>, "Move assignable type required");
+
+    entt::storage<blob_type> other{std::move(pool)};
+
+    ASSERT_TRUE(other.contains(entity[0u]));
+    ASSERT_EQ(to_vector(other.get(entity[0u])), (std::vector{1, 2, 3}));
+
+    entt::storage<blob_type> extended{std::move(other), std::allocator<blob_type>{}};
+
+    ASSERT_EQ(to_vector(extended.get(entity[0u])), (std::vector{1, 2, 3}));
+
+    pool = std::move(extended);
+    pool.emplace(entity[1u]);
+
+    ASSERT_EQ(pool.size(), 2u);
+    ASSERT_TRUE(pool.get(entity[1u]).empty());
+}
+
+TEST_F(StorageBlob, Emplace) {
+    entt::storage<blob_type> pool;
+    const std::array entity{entt::entity{1}, entt::entity{3}, entt::entity{5}};
+    const std::array value{4, 5};
+
+    testing::StaticAssertTypeEq<decltype(pool.emplace({})), std::span<int>>();
+    testing::StaticAssertTypeEq<decltype(std::as_const(pool).get({})), std::span<const int>>();
+
+    ASSERT_EQ(pool.emplace(entity[0u], std::vector{1, 2, 3}).size(), 3u);
+    ASSERT_EQ(pool.emplace(entity[1u], value).size(), 2u);
+    // copies from the arena itself are safe
+    ASSERT_EQ(to_vector(pool.emplace(entity[2u], pool.get(entity[0u]))), (std::vector{1, 2, 3}));
+
+    pool.patch(entity[1u], [](auto elem) { elem[1u] = 6; });
+
+    ASSERT_EQ(to_vector(pool.get(entity[0u])), (std::vector{1, 2, 3}));
+    ASSERT_EQ(to_vector(std::as_const(pool).get(entity[1u])), (std::vector{4, 6}));
+    ASSERT_EQ(std::get<0>(pool.get_as_tuple(entity[2u])).size(), 3u);
+
+    auto &base = static_cast<entt::sparse_set &>(pool);
+    const std::span<const int> instance{value};
+
+    base.push(entt::entity{7}, &instance);
+    base.push(entt::entity{9});
+
+    ASSERT_EQ(to_vector(pool.get(entt::entity{7})), (std::vector{4, 5}));
+    ASSERT_TRUE(pool.get(entt::entity{9}).empty());
+}
+
+TEST_F(StorageBlob, Insert) {
+    entt::storage<blob_type> pool;
+    const std::array entity{entt::entity{1}, entt::entity{3}};
+
+    pool.insert(entity.begin(), entity.end(), std::vector{1, 2});
+
+    ASSERT_EQ(pool.size(), 2u);
+    ASSERT_EQ(to_vector(pool.get(entity[0u])), (std::vector{1, 2}));
+    ASSERT_EQ(to_vector(pool.get(entity[1u])), (std::vector{1, 2}));
+    ASSERT_NE(pool.get(entity[0u]).data(), pool.get(entity[1u]).data());
+}
+
+TEST_F(StorageBlob, Erase) {
+    entt::storage<blob_type> pool;
+    const std::array entity{entt::entity{1}, entt::entity{3}, entt::entity{5}};
+
+    pool.emplace(entity[0u], std::vector{1});
+    pool.emplace(entity[1u], std::vector{2, 2});
+    pool.emplace(entity[2u], std::vector{3, 3, 3});
+
+    pool.erase(entity[0u]);
+
+    ASSERT_EQ(pool.size(), 2u);
+    ASSERT_FALSE(pool.contains(entity[0u]));
+    ASSERT_EQ(to_vector(pool.get(entity[1u])), (std::vector{2, 2}));
+    ASSERT_EQ(to_vector(pool.get(entity[2u])), (std::vector{3, 3, 3}));
+
+    pool.swap_elements(entity[1u], entity[2u]);
+    pool.shrink_to_fit();
+
+    // sequences follow the order of the entities after a compaction
+    ASSERT_EQ(pool.get(pool.data()[0u]).data() + pool.get(pool.data()[0u]).size(), pool.get(pool.data()[1u]).data());
+    ASSERT_EQ(to_vector(pool.get(entity[1u])), (std::vector{2, 2}));
+    ASSERT_EQ(to_vector(pool.get(entity[2u])), (std::vector{3, 3, 3}));
+
+    pool.erase(entity[2u]);
+
+    // unused elements outnumber live ones, the arena is compacted
+    ASSERT_EQ(to_vector(pool.get(entity[1u])), (std::vector{2, 2}));
+
+    pool.clear();
+
+    ASSERT_TRUE(pool.empty());
+}
+
+TEST_F(StorageBlob, Iterator) {
+    entt::storage<blob_type> pool;
+    const std::array entity{entt::entity{1}, entt::entity{3}};
+
+    pool.emplace(entity[0u], std::vector{1});
+    pool.emplace(entity[1u], std::vector{2, 3});
+
+    ASSERT_EQ(pool.end() - pool.begin(), 2);
+    ASSERT_EQ(pool.rend() - pool.rbegin(), 2);
+    ASSERT_EQ(to_vector(*pool.begin()), (std::vector{2, 3}));
+    ASSERT_EQ(to_vector(*pool.rbegin()), (std::vector{1}));
+    ASSERT_EQ(pool.begin()->size(), 2u);
+
+    typename entt::storage<blob_type>::const_iterator cit = pool.begin();
+
+    ASSERT_EQ(cit, pool.cbegin());
+    ASSERT_EQ(to_vector(cit[1]), (std::vector{1}));
+
+    std::size_t count{};
+
+    for(auto [entt, elem]: pool.each()) {
+        testing::StaticAssertTypeEq<decltype(elem), std::span<int>>();
+        ASSERT_EQ(elem.size(), entt == entity[0u] ? 1u : 2u);
+        elem[0u] *= 10;
+        ++count;
+    }
+
+    for(auto [entt, elem]: std::as_const(pool).reach()) {
+        testing::StaticAssertTypeEq<decltype(elem), std::span<const int>>();
+        ASSERT_EQ(elem[0u] % 10, 0);
+    }
+
+    ASSERT_EQ(count, 2u);
+    ASSERT_EQ(pool.get(entity[1u])[0u], 20);
+}
+
+TEST_F(StorageBlob, Registry) {
+    entt::registry registry;
+    const auto entity = registry.create();
+    const auto other = registry.create();
+
+    registry.emplace<blob_type>(entity, std::vector{1, 2, 3});
+    registry.emplace<blob_type>(other);
+    registry.emplace<char>(entity, 'c');
+
+    ASSERT_EQ(registry.get<blob_type>(entity).size(), 3u);
+    ASSERT_TRUE(registry.get<blob_type>(other).empty());
+
+    std::size_t count{};
+
+    registry.view<blob_type, char>().each([&count](std::span<int> elem, char &value) {
+        ASSERT_EQ(elem.size(), 3u);
+        ASSERT_EQ(value, 'c');
+        ++count;
+    });
+
+    ASSERT_EQ(count, 1u);
+
+    auto [elem, value] = registry.get<blob_type, char>(entity);
+
+    ASSERT_EQ(elem[2u], 3);
+    ASSERT_EQ(value, 'c');
+
+    registry.destroy(entity);
+
+    ASSERT_EQ(registry.storage<blob_type>().size(), 1u);
+}
+
+TEST_F(StorageBlob, Group) {
+    entt::registry registry;
+    const std::array entity{registry.create(), registry.create(), registry.create()};
+
+    registry.emplace<blob_type>(entity[0u], std::vector{1});
+    registry.emplace<blob_type>(entity[1u], std::vector{2, 2});
+    registry.emplace<blob_type>(entity[2u], std::vector{3, 3, 3});
+    registry.emplace<char>(entity[2u], 'c');
+    registry.emplace<char>(entity[0u], 'a');
+
+    auto group = registry.group<blob_type>(entt::get<char>);
+
+    ASSERT_EQ(group.size(), 2u);
+
+    for(auto [entt, elem, value]: group.each()) {
+        ASSERT_EQ(elem.size(), entt == entity[0u] ? 1u : 3u);
+        ASSERT_EQ(value, entt == entity[0u] ? 'a' : 'c');
+    }
+
+    ASSERT_EQ(registry.get<blob_type>(entity[1u]).size(), 2u);
+}
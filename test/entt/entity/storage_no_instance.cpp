@@ -6,6 +6,7 @@
 #include <type_traits>
 #include <utility>
 #include <gtest/gtest.h>
+#include <entt/container/bitset.hpp>
 #include <entt/core/iterator.hpp>
 #include <entt/core/type_info.hpp>
 #include <entt/entity/component.hpp>
@@ -52,7 +53,7 @@ struct StorageNoInstance: testing::Test {
 template<typename Type>
 using StorageNoInstanceDeathTest = StorageNoInstance<Type>;
 
-using StorageNoInstanceTypes = ::testing::Types<test::empty, void>;
+using StorageNoInstanceTypes = ::testing::Types<test::empty, test::bitset_empty, void>;
 
 TYPED_TEST_SUITE(StorageNoInstance, StorageNoInstanceTypes, );
 TYPED_TEST_SUITE(StorageNoInstanceDeathTest, StorageNoInstanceTypes, );
@@ -728,3 +729,41 @@ TYPED_TEST(StorageNoInstance, SortAsUnordered) {
     ASSERT_EQ(rhs.data()[4u], rhs_entity[4u]);
     ASSERT_EQ(rhs.data()[5u], rhs_entity[5u]);
 }
+
+TEST(StorageNoInstance, Bitset) {
+    using traits_type = entt::entt_traits<entt::entity>;
+
+    entt::storage<test::bitset_empty> pool;
+    const std::array entity{entt::entity{1}, entt::entity{64}, entt::entity{3}};
+
+    testing::StaticAssertTypeEq<decltype(pool.bitset()), const entt::bitset &>();
+
+    ASSERT_TRUE(pool.bitset().none());
+
+    pool.insert(entity.begin(), entity.end());
+
+    ASSERT_EQ(pool.bitset().count(), 3u);
+    ASSERT_TRUE(pool.bitset().test(64u));
+    ASSERT_TRUE(pool.contains(entity[1u]));
+    ASSERT_FALSE(pool.contains(traits_type::next(entity[1u])));
+
+    pool.erase(entity[1u]);
+
+    ASSERT_FALSE(pool.bitset().test(64u));
+    ASSERT_FALSE(pool.contains(entity[1u]));
+
+    pool.emplace(traits_type::next(entity[1u]));
+
+    ASSERT_TRUE(pool.bitset().test(64u));
+    ASSERT_FALSE(pool.contains(entity[1u]));
+    ASSERT_TRUE(pool.contains(traits_type::next(entity[1u])));
+
+    entt::storage<test::bitset_empty> other{std::move(pool)};
+
+    ASSERT_EQ(other.bitset().count(), 3u);
+
+    other.clear();
+
+    ASSERT_TRUE(other.bitset().none());
+    ASSERT_FALSE(other.contains(entity[0u]));
+}
@@ -1,9 +1,14 @@
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <cstddef>
 #include <iterator>
+#include <span>
 #include <tuple>
 #include <utility>
+#include <vector>
 #include <gtest/gtest.h>
+#include <entt/core/job_system.hpp>
 #include <entt/core/type_info.hpp>
 #include <entt/entity/entity.hpp>
 #include <entt/entity/storage.hpp>
@@ -234,6 +239,118 @@ TEST(ViewSingleStorage, Each) {
     }
 }
 
+TEST(ViewSingleStorage, ParEach) {
+    entt::job_system jobs{4u};
+    entt::storage<int> storage{};
+    const entt::basic_view view{storage};
+    const entt::basic_view cview{std::as_const(storage)};
+    std::atomic<std::size_t> counter{};
+
+    view.par_each(jobs, [&counter](int &) { ++counter; });
+
+    ASSERT_EQ(counter, 0u);
+
+    for(std::size_t pos{}; pos < 3u * ENTT_PACKED_PAGE + 1u; ++pos) {
+        storage.emplace(entt::entity{static_cast<entt::id_type>(pos)}, 0);
+    }
+
+    view.par_each(jobs, [&counter](const auto entt, int &value) {
+        value = static_cast<int>(entt::to_integral(entt));
+        ++counter;
+    });
+
+    ASSERT_EQ(counter, storage.size());
+
+    cview.par_each(jobs, [&counter](const int &value) {
+        ASSERT_GE(value, 0);
+        --counter;
+    });
+
+    ASSERT_EQ(counter, 0u);
+
+    for(auto [entt, value]: view.each()) {
+        ASSERT_EQ(static_cast<int>(entt::to_integral(entt)), value);
+    }
+}
+
+TEST(ViewSingleStorage, ParEachStableType) {
+    entt::job_system jobs{4u};
+    entt::storage<test::pointer_stable> storage{};
+    const entt::basic_view view{storage};
+    std::atomic<std::size_t> counter{};
+
+    for(std::size_t pos{}; pos < 2u * ENTT_PACKED_PAGE; ++pos) {
+        storage.emplace(entt::entity{static_cast<entt::id_type>(pos)}, static_cast<int>(pos));
+    }
+
+    const entt::sparse_set &base = storage;
+    storage.erase(base.begin(), base.begin() + ENTT_PACKED_PAGE / 2);
+
+    view.par_each(jobs, [&counter](const auto entt, test::pointer_stable &elem) {
+        ASSERT_EQ(elem, test::pointer_stable{static_cast<int>(entt::to_integral(entt))});
+        ++counter;
+    });
+
+    ASSERT_EQ(counter, 2u * ENTT_PACKED_PAGE - ENTT_PACKED_PAGE / 2);
+}
+
+TEST(ViewSingleStorage, Chunks) {
+    entt::storage<int> storage{};
+    entt::basic_view view{storage};
+    const entt::basic_view cview{std::as_const(storage)};
+
+    ASSERT_EQ(view.chunks(8u).begin(), view.chunks(8u).end());
+
+    const entt::basic_view<entt::get_t<entt::storage<int>>, entt::exclude_t<>> invalid{};
+
+    ASSERT_EQ(invalid.chunks(8u).begin(), invalid.chunks(8u).end());
+
+    for(std::size_t pos{}; pos < ENTT_PACKED_PAGE + 3u; ++pos) {
+        storage.emplace(entt::entity{static_cast<entt::id_type>(pos)}, static_cast<int>(pos));
+    }
+
+    testing::StaticAssertTypeEq<decltype(*view.chunks(1u).begin()), std::tuple<std::span<const entt::entity>, std::span<int>>>();
+    testing::StaticAssertTypeEq<decltype(*cview.chunks(1u).begin()), std::tuple<std::span<const entt::entity>, std::span<const int>>>();
+
+    std::size_t count{};
+    std::size_t total{};
+
+    for(auto [entities, values]: view.chunks(ENTT_PACKED_PAGE / 2u + 1u)) {
+        ASSERT_EQ(entities.size(), values.size());
+
+        for(std::size_t pos{}; pos < entities.size(); ++pos) {
+            ASSERT_EQ(static_cast<int>(entt::to_integral(entities[pos])), values[pos]);
+        }
+
+        total += values.size();
+        ++count;
+    }
+
+    // chunks do not cross the first page
+    ASSERT_EQ(count, 3u);
+    ASSERT_EQ(total, storage.size());
+}
+
+TEST(ViewSingleStorage, ChunksStableType) {
+    entt::storage<test::pointer_stable> storage{};
+    const entt::basic_view view{storage};
+    const std::array entity{entt::entity{1}, entt::entity{3}, entt::entity{5}, entt::entity{7}};
+
+    storage.insert(entity.begin(), entity.end());
+    storage.erase(entity[1u]);
+
+    std::vector<std::size_t> length{};
+
+    for(auto [entities, values]: view.chunks(8u)) {
+        testing::StaticAssertTypeEq<decltype(values), std::span<test::pointer_stable>>();
+        ASSERT_EQ(entities.size(), values.size());
+        length.push_back(entities.size());
+    }
+
+    // tombstones split chunks
+    ASSERT_EQ(length, (std::vector<std::size_t>{1u, 2u}));
+}
+
 TEST(ViewSingleStorage, ConstNonConstAndAllInBetween) {
     entt::storage<int> storage{};
     const entt::basic_view view{storage};
@@ -991,6 +1108,51 @@ TEST(ViewMultiStorage, Each) {
     }
 }
 
+TEST(ViewMultiStorage, ParEach) {
+    entt::job_system jobs{4u};
+    std::tuple<entt::storage<int>, entt::storage<char>, entt::storage<double>> storage{};
+    entt::basic_view view{std::forward_as_tuple(std::get<0>(storage), std::get<1>(storage)), std::forward_as_tuple(std::get<2>(storage))};
+    std::atomic<std::size_t> counter{};
+    std::size_t expected{};
+
+    for(std::size_t pos{}; pos < 4u * ENTT_PACKED_PAGE + 3u; ++pos) {
+        const entt::entity entity{static_cast<entt::id_type>(pos)};
+
+        std::get<0>(storage).emplace(entity, 0);
+
+        if(pos % 2u == 0u) {
+            std::get<1>(storage).emplace(entity, static_cast<char>(0));
+        }
+
+        if(pos % 3u == 0u) {
+            std::get<2>(storage).emplace(entity, 0.);
+        }
+
+        expected += static_cast<std::size_t>((pos % 2u == 0u) && (pos % 3u != 0u));
+    }
+
+    view.par_each(jobs, [&counter](const auto entt, int &ivalue, char &cvalue) {
+        ivalue = static_cast<int>(entt::to_integral(entt));
+        cvalue = 1;
+        ++counter;
+    });
+
+    ASSERT_EQ(counter, expected);
+
+    view.use<int>();
+    view.par_each(jobs, [&counter](int &ivalue, char &cvalue) {
+        ASSERT_EQ(cvalue, 1);
+        ASSERT_NE(ivalue % 3, 0);
+        --counter;
+    });
+
+    ASSERT_EQ(counter, 0u);
+
+    for(auto [entt, ivalue]: std::get<0>(storage).each()) {
+        ASSERT_EQ(ivalue, view.contains(entt) ? static_cast<int>(entt::to_integral(entt)) : 0);
+    }
+}
+
 TEST(ViewMultiStorage, EachWithSuggestedType) {
     std::tuple<entt::storage<int>, entt::storage<char>> storage{};
     entt::basic_view view{std::get<0>(storage), std::get<1>(storage)};
@@ -1068,6 +1230,175 @@ TEST(ViewMultiStorage, EachWithHoles) {
     }
 }
 
+TEST(ViewMultiStorage, EachInBlocks) {
+    std::tuple<entt::storage<int>, entt::storage<char>, entt::storage<double>> storage{};
+    entt::basic_view view{std::forward_as_tuple(std::get<0>(storage), std::get<1>(storage)), std::forward_as_tuple(std::get<2>(storage))};
+    std::vector<entt::entity> expected{};
+    std::vector<entt::entity> visited{};
+
+    // partial overlaps that span several blocks and a trailing partial block
+    for(std::size_t pos{}; pos < 75u; ++pos) {
+        const entt::entity entity{static_cast<entt::id_type>(pos)};
+
+        std::get<0>(storage).emplace(entity, static_cast<int>(pos));
+        (pos % 3u) ? void() : static_cast<void>(std::get<1>(storage).emplace(entity, 'c'));
+        (pos % 5u) ? void() : static_cast<void>(std::get<2>(storage).emplace(entity));
+    }
+
+    view.use<int>();
+
+    for(auto entt: view) {
+        expected.push_back(entt);
+    }
+
+    view.each([&visited](const auto entt, const int &value, char &) {
+        ASSERT_EQ(static_cast<int>(entt::to_integral(entt)), value);
+        visited.push_back(entt);
+    });
+
+    ASSERT_EQ(expected.size(), 20u);
+    ASSERT_EQ(visited, expected);
+
+    view.use<char>();
+    visited.clear();
+
+    view.each([&visited](const auto entt, auto &&...) { visited.push_back(entt); });
+
+    ASSERT_EQ(visited, expected);
+}
+
+TEST(ViewMultiStorage, EachInBlocksAndGrow) {
+    std::tuple<entt::storage<int>, entt::storage<char>> storage{};
+    entt::basic_view view{std::get<0>(storage), std::get<1>(storage)};
+    std::size_t visited{};
+
+    for(std::size_t pos{}; pos < 40u; ++pos) {
+        const entt::entity entity{static_cast<entt::id_type>(pos)};
+
+        std::get<0>(storage).emplace(entity, static_cast<int>(pos));
+        std::get<1>(storage).emplace(entity, 'c');
+    }
+
+    view.use<int>();
+
+    // the packed array is reallocated while the first block is visited
+    view.each([&](const auto entt, const int &value, char &) {
+        ASSERT_EQ(static_cast<int>(entt::to_integral(entt)), value);
+
+        if(visited++ == 0u) {
+            for(std::size_t pos{}; pos < 1000u; ++pos) {
+                std::get<0>(storage).emplace(entt::entity{static_cast<entt::id_type>(pos + 40u)});
+            }
+        }
+    });
+
+    ASSERT_EQ(visited, 40u);
+    ASSERT_EQ(std::get<0>(storage).size(), 1040u);
+}
+
+TEST(ViewMultiStorage, Chunks) {
+    std::tuple<entt::storage<int>, entt::storage<char>, entt::storage<test::empty>, entt::storage<double>> storage{};
+    entt::basic_view view{std::forward_as_tuple(std::get<0>(storage), std::get<1>(storage), std::get<2>(storage)), std::forward_as_tuple(std::get<3>(storage))};
+    const entt::basic_view cview{std::forward_as_tuple(std::as_const(std::get<0>(storage)), std::get<1>(storage))};
+
+    ASSERT_EQ(view.chunks(8u).begin(), view.chunks(8u).end());
+
+    const entt::basic_view<entt::get_t<entt::storage<int>, entt::storage<char>>, entt::exclude_t<>> invalid{};
+
+    ASSERT_EQ(invalid.chunks(8u).begin(), invalid.chunks(8u).end());
+
+    testing::StaticAssertTypeEq<decltype(*view.chunks(1u).begin()), std::tuple<std::span<const entt::entity>, std::span<int>, std::span<char>>>();
+    testing::StaticAssertTypeEq<decltype(*cview.chunks(1u).begin()), std::tuple<std::span<const entt::entity>, std::span<const int>, std::span<char>>>();
+
+    for(std::size_t pos{}; pos < 8u; ++pos) {
+        const entt::entity entity{static_cast<entt::id_type>(pos)};
+
+        std::get<0>(storage).emplace(entity, static_cast<int>(pos));
+        std::get<1>(storage).emplace(entity, static_cast<char>(pos));
+        std::get<2>(storage).emplace(entity);
+    }
+
+    std::vector<std::size_t> length{};
+
+    for(auto [entities, ivalues, cvalues]: view.chunks(4u)) {
+        for(std::size_t pos{}; pos < entities.size(); ++pos) {
+            ASSERT_EQ(static_cast<int>(entt::to_integral(entities[pos])), ivalues[pos]);
+            ASSERT_EQ(static_cast<char>(entt::to_integral(entities[pos])), cvalues[pos]);
+        }
+
+        length.push_back(entities.size());
+    }
+
+    // storage are sorted alike, chunks are as large as requested
+    ASSERT_EQ(length, (std::vector<std::size_t>{4u, 4u}));
+
+    std::get<1>(storage).swap_elements(entt::entity{1}, entt::entity{2});
+    std::get<3>(storage).emplace(entt::entity{6});
+    length.clear();
+
+    for(auto [entities, ivalues, cvalues]: view.chunks(4u)) {
+        for(std::size_t pos{}; pos < entities.size(); ++pos) {
+            ASSERT_EQ(static_cast<int>(entt::to_integral(entities[pos])), ivalues[pos]);
+            ASSERT_EQ(static_cast<char>(entt::to_integral(entities[pos])), cvalues[pos]);
+        }
+
+        length.push_back(entities.size());
+    }
+
+    // runs end where storage aren't sorted alike and at excluded entities
+    ASSERT_EQ(length, (std::vector<std::size_t>{1u, 1u, 1u, 3u, 1u}));
+}
+
+struct prefetched {
+    static constexpr auto prefetch_distance = 8u;
+    int value{};
+};
+
+TEST(ViewMultiStorage, Prefetch) {
+    std::tuple<entt::storage<int>, entt::storage<prefetched>, entt::storage<char>> storage{};
+    entt::basic_view view{std::forward_as_tuple(std::get<0>(storage), std::get<1>(storage)), std::forward_as_tuple(std::get<2>(storage))};
+    const entt::basic_view other{std::get<0>(storage), std::get<2>(storage)};
+
+    ASSERT_EQ(view.prefetch_distance(), 8u);
+    ASSERT_EQ(other.prefetch_distance(), 0u);
+    ASSERT_EQ((other | std::get<1>(storage)).prefetch_distance(), 8u);
+
+    for(std::size_t pos{}; pos < 64u; ++pos) {
+        const entt::entity entity{static_cast<entt::id_type>(pos)};
+        // elements are stored in reverse order, pools aren't sorted alike
+        const entt::entity reverse{static_cast<entt::id_type>(63u - pos)};
+
+        std::get<0>(storage).emplace(entity, static_cast<int>(pos));
+        std::get<1>(storage).emplace(reverse, static_cast<int>(63u - pos));
+        (pos % 7u) ? void() : static_cast<void>(std::get<2>(storage).emplace(entity));
+    }
+
+    view.use<int>();
+
+    for(const auto distance: {0u, 1u, 8u, 100u}) {
+        std::size_t count{};
+
+        view.prefetch_distance(distance);
+
+        ASSERT_EQ(view.prefetch_distance(), distance);
+
+        view.each([&count](const auto entt, const int &value, const prefetched &elem) {
+            ASSERT_EQ(static_cast<int>(entt::to_integral(entt)), value);
+            ASSERT_EQ(value, elem.value);
+            ++count;
+        });
+
+        for(auto [entt, value, elem]: view.each()) {
+            ASSERT_EQ(static_cast<int>(entt::to_integral(entt)), value);
+            ASSERT_EQ(value, elem.value);
+            --count;
+        }
+
+        ASSERT_EQ(count, 0u);
+        ASSERT_EQ(std::distance(view.begin(), view.end()), 54);
+    }
+}
+
 TEST(ViewMultiStorage, ConstNonConstAndAllInBetween) {
     std::tuple<entt::storage<int>, entt::storage<test::empty>, entt::storage<char>> storage{};
     const entt::basic_view view{std::get<0>(storage), std::get<1>(storage), std::as_const(std::get<2>(storage))};
@@ -1205,6 +1536,61 @@ TEST(ViewMultiStorage, EmptyType) {
     }
 }
 
+TEST(ViewMultiStorage, BitsetTag) {
+    using traits_type = entt::entt_traits<entt::entity>;
+
+    std::tuple<entt::storage<int>, entt::storage<test::bitset_empty>> storage{};
+    const entt::basic_view view{std::get<0>(storage), std::get<1>(storage)};
+    const entt::basic_view exclude{std::forward_as_tuple(std::get<0>(storage)), std::forward_as_tuple(std::get<1>(storage))};
+    std::vector<entt::entity> expected{};
+    std::vector<entt::entity> visited{};
+    std::size_t count{};
+
+    for(std::size_t pos{}; pos < 75u; ++pos) {
+        const entt::entity entity{static_cast<entt::id_type>(pos)};
+
+        std::get<0>(storage).emplace(entity, static_cast<int>(pos));
+        (pos % 3u) ? void() : std::get<1>(storage).emplace(entity);
+    }
+
+    // a tag assigned to a different version of an identifier doesn't count
+    std::get<1>(storage).erase(entt::entity{3});
+    std::get<1>(storage).emplace(traits_type::construct(3, 1));
+
+    ASSERT_TRUE(std::get<1>(storage).bitset().test(3u));
+    ASSERT_FALSE(view.contains(entt::entity{3}));
+    ASSERT_TRUE(exclude.contains(entt::entity{3}));
+
+    for(auto entt: view) {
+        expected.push_back(entt);
+    }
+
+    view.each([&visited](const auto entt, const int &value) {
+        ASSERT_EQ(static_cast<int>(entt::to_integral(entt)), value);
+        ASSERT_EQ(value % 3, 0);
+        visited.push_back(entt);
+    });
+
+    ASSERT_EQ(expected.size(), 24u);
+    ASSERT_EQ(visited, expected);
+
+    exclude.each([&count](const auto entt, const int &value) {
+        ASSERT_TRUE(value % 3 != 0 || entt == entt::entity{3});
+        ++count;
+    });
+
+    ASSERT_EQ(count, 51u);
+
+    std::get<1>(storage).clear();
+    count = 0u;
+
+    ASSERT_EQ(std::get<1>(storage).bitset().count(), 0u);
+
+    exclude.each([&count](auto &&...) { ++count; });
+
+    ASSERT_EQ(count, 75u);
+}
+
 TEST(ViewMultiStorage, FrontBack) {
     std::tuple<entt::storage<int>, entt::storage<char>> storage{};
     const entt::basic_view view{std::as_const(std::get<0>(storage)), std::as_const(std::get<1>(storage))};
@@ -104,6 +104,20 @@ TEST(Process, Basics) {
     ASSERT_TRUE(process.rejected());
 }
 
+TEST(Process, Independent) {
+    test_process<int> process{};
+
+    ASSERT_FALSE(process.independent());
+
+    process.independent(true);
+
+    ASSERT_TRUE(process.independent());
+
+    process.independent(false);
+
+    ASSERT_FALSE(process.independent());
+}
+
 TEST(Process, SucceedNoOverride) {
     test_plain_process process{};
 
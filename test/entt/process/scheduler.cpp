@@ -1,8 +1,12 @@
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <memory>
 #include <utility>
+#include <vector>
 #include <gtest/gtest.h>
+#include <entt/core/job_system.hpp>
 #include <entt/process/process.hpp>
 #include <entt/process/scheduler.hpp>
 
@@ -193,6 +197,47 @@ TEST(Scheduler, SpawningProcess) {
     ASSERT_EQ(counter.second, 1u);
 }
 
+TEST(Scheduler, ParallelUpdate) {
+    entt::job_system jobs{4u};
+    entt::scheduler scheduler{};
+    std::pair<int, int> counter{};
+    std::atomic<int> ticks{};
+    std::vector<int> order{};
+    std::size_t count{};
+
+    for(int next{}; next < 64; ++next) {
+        auto &proc = scheduler.attach([&ticks](entt::process &elem, std::uint32_t, void *) {
+            (ticks.fetch_add(1, std::memory_order_relaxed) % 2) ? elem.succeed() : elem.fail();
+        });
+
+        proc.independent(true);
+        proc.then<succeeded_process>();
+    }
+
+    for(int next{}; next < 4; ++next) {
+        scheduler.attach([&order, &scheduler, next](entt::process &proc, std::uint32_t, void *) {
+            order.push_back(next);
+            scheduler.attach<failed_process>();
+            proc.succeed();
+        });
+    }
+
+    scheduler.update(jobs, 0, &counter);
+
+    ASSERT_EQ(ticks.load(), 64);
+    ASSERT_EQ(order, (std::vector<int>{3, 2, 1, 0}));
+    ASSERT_EQ(scheduler.size(), 64u / 2u + 4u);
+
+    while(!scheduler.empty()) {
+        scheduler.update(jobs, 0, &counter);
+        ++count;
+    }
+
+    ASSERT_EQ(count, 1u);
+    ASSERT_EQ(counter.first, 32);
+    ASSERT_EQ(counter.second, 4);
+}
+
 TEST(Scheduler, CustomAllocator) {
     const std::allocator<void> allocator{};
     entt::scheduler scheduler{allocator};
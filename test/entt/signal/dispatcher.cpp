@@ -1,7 +1,11 @@
+#include <array>
+#include <cstddef>
 #include <memory>
 #include <utility>
+#include <vector>
 #include <gtest/gtest.h>
 #include <entt/core/hashed_string.hpp>
+#include <entt/core/job_system.hpp>
 #include <entt/signal/dispatcher.hpp>
 #include "../../common/value_type.h"
 
@@ -21,6 +25,16 @@ struct receiver {
         }
     }
 
+    static void forward_concurrent_int(entt::concurrent_dispatcher &owner, int &value) {
+        for(int next{}; next < value; ++next) {
+            owner.enqueue<int>(value);
+        }
+    }
+
+    static void split(std::array<std::vector<int>, 4u> &received, test::boxed_int &event) {
+        received[static_cast<std::size_t>(event.value % 4)].push_back(event.value / 4);
+    }
+
     void receive(const test::empty &) {
         ++cnt;
     }
@@ -218,3 +232,80 @@ TEST(Dispatcher, CustomAllocator) {
 
     ASSERT_EQ(other.size<test::empty>(), 1u);
 }
+
+TEST(Dispatcher, Policy) {
+    ASSERT_TRUE(noexcept(std::declval<entt::dispatcher &>().clear()));
+    ASSERT_TRUE(noexcept(std::declval<const entt::dispatcher &>().size()));
+    ASSERT_FALSE(noexcept(std::declval<entt::concurrent_dispatcher &>().clear()));
+    ASSERT_FALSE(noexcept(std::declval<const entt::concurrent_dispatcher &>().size()));
+}
+
+TEST(Dispatcher, Concurrent) {
+    constexpr int length = 1024;
+    entt::job_system jobs{4u};
+    entt::concurrent_dispatcher dispatcher{};
+    std::array<std::vector<int>, 4u> received{};
+
+    dispatcher.sink<test::boxed_int>().connect<&receiver::split>(received);
+
+    jobs.parallel_for(received.size(), [&dispatcher](const std::size_t pos) {
+        for(int next{}; next < length; ++next) {
+            dispatcher.enqueue<test::boxed_int>(next * 4 + static_cast<int>(pos));
+        }
+    });
+
+    ASSERT_EQ(dispatcher.size<test::boxed_int>(), received.size() * length);
+    ASSERT_EQ(dispatcher.size(), received.size() * length);
+
+    dispatcher.update();
+
+    ASSERT_EQ(dispatcher.size(), 0u);
+
+    for(auto &&elem: received) {
+        ASSERT_EQ(elem.size(), static_cast<std::size_t>(length));
+
+        for(int next{}; next < length; ++next) {
+            // events are delivered in order for each producer
+            ASSERT_EQ(elem[static_cast<std::size_t>(next)], next);
+        }
+    }
+
+    jobs.parallel_for(received.size(), [&dispatcher](const std::size_t pos) {
+        dispatcher.enqueue<test::boxed_int>(static_cast<int>(pos));
+        dispatcher.enqueue<test::empty>();
+    });
+
+    ASSERT_EQ(dispatcher.size(), received.size() * 2u);
+
+    dispatcher.clear<test::boxed_int>();
+
+    ASSERT_EQ(dispatcher.size<test::boxed_int>(), 0u);
+    ASSERT_EQ(dispatcher.size<test::empty>(), received.size());
+
+    dispatcher.clear();
+
+    ASSERT_EQ(dispatcher.size(), 0u);
+}
+
+TEST(Dispatcher, ConcurrentAutoQueue) {
+    entt::concurrent_dispatcher dispatcher{};
+    entt::concurrent_dispatcher other{std::move(dispatcher)};
+
+    other.sink<int>().connect<&receiver::forward_concurrent_int>(other);
+
+    other.enqueue<int>(4);
+    other.update<int>();
+
+    ASSERT_EQ(other.size<int>(), 4u);
+
+    other.update<int>();
+
+    ASSERT_EQ(other.size<int>(), 16u);
+
+    dispatcher = std::move(other);
+    dispatcher.enqueue<non_aggregate>(0);
+
+    ASSERT_EQ(dispatcher.size<int>(), 16u);
+    ASSERT_EQ(dispatcher.size<non_aggregate>(), 1u);
+    ASSERT_EQ(dispatcher.size(), 17u);
+}